@@ -0,0 +1,548 @@
+#pragma once
+
+#include "../matrix_utils/checks.h"
+#include "../utils/sign.h"
+#include "../utils/thread_pool.h"
+#include "fixed_kernels.h"
+
+#include <limits>
+#include <vector>
+
+namespace LinearKit::Algorithm {
+using IndexType = LinearKit::Details::Types::IndexType;
+
+namespace Details {
+inline constexpr IndexType kBatchChunkSize = 64;
+inline constexpr IndexType kBatchedJacobiMaxSweeps = 30;
+} // namespace Details
+
+// count matrices of the same size rows x cols. The entries (i, j) of all
+// matrices are stored next to each other, so the batched algorithms run the
+// same operation over the batch in the innermost loop, and the compiler maps
+// it onto SIMD lanes.
+template <Utils::FloatOrComplex T>
+class MatrixBatch {
+public:
+    using ElemType = T;
+
+    MatrixBatch() = default;
+
+    MatrixBatch(IndexType count, IndexType rows, IndexType cols)
+        : count_(count), rows_(rows), cols_(cols),
+          data_(count * rows * cols) {
+        assert(count >= 0 && rows >= 0 && cols >= 0 && "Wrong batch size.");
+    }
+
+    // From count row-major matrices with batch_stride elements between the
+    // beginnings of the consecutive ones.
+    MatrixBatch(const T *data, IndexType count, IndexType rows,
+                IndexType cols, IndexType batch_stride)
+        : MatrixBatch(count, rows, cols) {
+        assert(batch_stride >= rows * cols && "Matrices overlap.");
+
+        for (IndexType b = 0; b < count; ++b) {
+            const auto *matrix = data + b * batch_stride;
+            for (IndexType k = 0; k < rows * cols; ++k) {
+                data_[k * count + b] = matrix[k];
+            }
+        }
+    }
+
+    template <MatrixUtils::MatrixType M>
+    explicit MatrixBatch(const std::vector<M> &matrices)
+        : MatrixBatch(matrices.size(),
+                      matrices.empty() ? 0 : matrices.front().Rows(),
+                      matrices.empty() ? 0 : matrices.front().Columns()) {
+        for (IndexType b = 0; b < count_; ++b) {
+            Set(b, matrices[b]);
+        }
+    }
+
+    [[nodiscard]] IndexType Count() const {
+        return count_;
+    }
+
+    [[nodiscard]] IndexType Rows() const {
+        return rows_;
+    }
+
+    [[nodiscard]] IndexType Columns() const {
+        return cols_;
+    }
+
+    T &operator()(IndexType b, IndexType i, IndexType j) {
+        return data_[(i * cols_ + j) * count_ + b];
+    }
+
+    const T &operator()(IndexType b, IndexType i, IndexType j) const {
+        return data_[(i * cols_ + j) * count_ + b];
+    }
+
+    // The entries (i, j) of all matrices.
+    T *Lanes(IndexType i, IndexType j) {
+        return data_.data() + (i * cols_ + j) * count_;
+    }
+
+    const T *Lanes(IndexType i, IndexType j) const {
+        return data_.data() + (i * cols_ + j) * count_;
+    }
+
+    Matrix<T> Get(IndexType b) const {
+        assert(b >= 0 && b < count_ && "Wrong batch index.");
+
+        Matrix<T> result(rows_, cols_);
+        for (IndexType i = 0; i < rows_; ++i) {
+            for (IndexType j = 0; j < cols_; ++j) {
+                result(i, j) = (*this)(b, i, j);
+            }
+        }
+
+        return result;
+    }
+
+    template <MatrixUtils::MatrixType M>
+    void Set(IndexType b, const M &matrix) {
+        assert(b >= 0 && b < count_ && "Wrong batch index.");
+        assert(matrix.Rows() == rows_ && matrix.Columns() == cols_ &&
+               "Wrong matrix size.");
+
+        for (IndexType i = 0; i < rows_; ++i) {
+            for (IndexType j = 0; j < cols_; ++j) {
+                (*this)(b, i, j) = matrix(i, j);
+            }
+        }
+    }
+
+    // Writes the matrices back in the layout of the strided constructor.
+    void CopyTo(T *data, IndexType batch_stride) const {
+        assert(batch_stride >= rows_ * cols_ && "Matrices overlap.");
+
+        for (IndexType b = 0; b < count_; ++b) {
+            auto *matrix = data + b * batch_stride;
+            for (IndexType k = 0; k < rows_ * cols_; ++k) {
+                matrix[k] = data_[k * count_ + b];
+            }
+        }
+    }
+
+    static MatrixBatch Identity(IndexType count, IndexType size) {
+        MatrixBatch result(count, size, size);
+        for (IndexType i = 0; i < size; ++i) {
+            std::fill_n(result.Lanes(i, i), count, T{1});
+        }
+
+        return result;
+    }
+
+private:
+    IndexType count_ = 0;
+    IndexType rows_ = 0;
+    IndexType cols_ = 0;
+    std::vector<T> data_;
+};
+
+namespace Details {
+template <Utils::FloatOrComplex T>
+struct BatchedPairQR {
+    MatrixBatch<T> Q;
+    MatrixBatch<T> R;
+};
+
+template <Utils::FloatOrComplex T>
+struct BatchedSingularBasis {
+    MatrixBatch<T> U;
+    MatrixBatch<T> S;
+    MatrixBatch<T> VT;
+};
+
+template <Utils::FloatOrComplex T>
+struct BatchedSpectralPair {
+    MatrixBatch<T> D;
+    MatrixBatch<T> U;
+};
+
+// Runs func(from, to) over the chunks of the batch in parallel.
+template <typename Func>
+void ForEachBatchChunk(IndexType count, Func &&func) {
+    auto chunks = (count + kBatchChunkSize - 1) / kBatchChunkSize;
+    Utils::ParallelFor(0, chunks, [&](std::ptrdiff_t chunk) {
+        auto from = chunk * kBatchChunkSize;
+        func(from, std::min(count, from + kBatchChunkSize));
+    });
+}
+
+// Householder QR of the lanes [from, to) of R, accumulating Q. Every lane
+// reflects by I - beta * v * v^H with v = x - alpha * e_1; a zero column
+// gets beta = 0 instead of a branch.
+template <Utils::FloatOrComplex T>
+void BatchedHouseholderQR(MatrixBatch<T> &Q, MatrixBatch<T> &R,
+                          IndexType from, IndexType to) {
+    using Real = Utils::RealType<T>;
+
+    auto rows = R.Rows();
+    auto cols = R.Columns();
+    auto lanes = to - from;
+
+    std::vector<T> v(rows * lanes);
+    std::vector<Real> beta(lanes);
+    std::vector<Real> norm(lanes);
+    std::vector<T> w(lanes);
+
+    for (IndexType k = 0; k < std::min(rows - 1, cols); ++k) {
+        std::fill(norm.begin(), norm.end(), Real{0});
+        for (IndexType i = k; i < rows; ++i) {
+            const auto *x = R.Lanes(i, k) + from;
+            for (IndexType b = 0; b < lanes; ++b) {
+                norm[b] += std::norm(x[b]);
+            }
+        }
+
+        auto *head = R.Lanes(k, k) + from;
+        for (IndexType b = 0; b < lanes; ++b) {
+            auto abs_head = std::abs(head[b]);
+            auto phase = (abs_head > 0) ? head[b] / abs_head : T{1};
+            auto alpha = -phase * std::sqrt(norm[b]);
+            auto v_head = head[b] - alpha;
+            auto v_norm = norm[b] - abs_head * abs_head + std::norm(v_head);
+
+            v[b] = v_head;
+            beta[b] = (v_norm > 0) ? Real{2} / v_norm : Real{0};
+        }
+        for (IndexType i = k + 1; i < rows; ++i) {
+            std::copy_n(R.Lanes(i, k) + from, lanes,
+                        v.begin() + (i - k) * lanes);
+        }
+
+        // R = H * R.
+        for (IndexType j = k; j < cols; ++j) {
+            std::fill(w.begin(), w.end(), T{0});
+            for (IndexType i = k; i < rows; ++i) {
+                const auto *r = R.Lanes(i, j) + from;
+                const auto *vi = v.data() + (i - k) * lanes;
+                for (IndexType b = 0; b < lanes; ++b) {
+                    w[b] += Utils::Conj(vi[b]) * r[b];
+                }
+            }
+            for (IndexType b = 0; b < lanes; ++b) {
+                w[b] *= beta[b];
+            }
+            for (IndexType i = k; i < rows; ++i) {
+                auto *r = R.Lanes(i, j) + from;
+                const auto *vi = v.data() + (i - k) * lanes;
+                for (IndexType b = 0; b < lanes; ++b) {
+                    r[b] -= vi[b] * w[b];
+                }
+            }
+        }
+
+        for (IndexType i = k + 1; i < rows; ++i) {
+            std::fill_n(R.Lanes(i, k) + from, lanes, T{0});
+        }
+
+        // Q = Q * H.
+        for (IndexType r = 0; r < rows; ++r) {
+            std::fill(w.begin(), w.end(), T{0});
+            for (IndexType i = k; i < rows; ++i) {
+                const auto *q = Q.Lanes(r, i) + from;
+                const auto *vi = v.data() + (i - k) * lanes;
+                for (IndexType b = 0; b < lanes; ++b) {
+                    w[b] += q[b] * vi[b];
+                }
+            }
+            for (IndexType b = 0; b < lanes; ++b) {
+                w[b] *= beta[b];
+            }
+            for (IndexType i = k; i < rows; ++i) {
+                auto *q = Q.Lanes(r, i) + from;
+                const auto *vi = v.data() + (i - k) * lanes;
+                for (IndexType b = 0; b < lanes; ++b) {
+                    q[b] -= w[b] * Utils::Conj(vi[b]);
+                }
+            }
+        }
+    }
+}
+
+// Columns p and q of the lanes [from, to) of A become (p, q) * W.
+template <Utils::FloatOrComplex T>
+void RotateBatchedColumns(MatrixBatch<T> &A, IndexType p, IndexType q,
+                          IndexType from, IndexType to,
+                          const std::vector<Utils::RealType<T>> &c,
+                          const std::vector<Utils::RealType<T>> &s,
+                          const std::vector<T> &e) {
+    for (IndexType i = 0; i < A.Rows(); ++i) {
+        auto *first = A.Lanes(i, p) + from;
+        auto *second = A.Lanes(i, q) + from;
+        for (IndexType b = 0; b < to - from; ++b) {
+            auto lhs = first[b];
+            auto rhs = Utils::Conj(e[b]) * second[b];
+            first[b] = c[b] * lhs - s[b] * rhs;
+            second[b] = s[b] * lhs + c[b] * rhs;
+        }
+    }
+}
+
+// Cyclic Jacobi method for the Hermitian lanes [from, to) of D with the
+// rotations accumulated in U.
+template <Utils::FloatOrComplex T>
+void BatchedJacobiEigen(MatrixBatch<T> &D, MatrixBatch<T> &U, IndexType from,
+                        IndexType to) {
+    using Real = Utils::RealType<T>;
+
+    auto size = D.Rows();
+    auto lanes = to - from;
+    auto tol = std::numeric_limits<Real>::epsilon() *
+               static_cast<Real>(std::max(size, IndexType{1}));
+
+    std::vector<Real> c(lanes);
+    std::vector<Real> s(lanes);
+    std::vector<T> e(lanes);
+    std::vector<Real> off(lanes);
+    std::vector<Real> total(lanes);
+
+    for (IndexType sweep = 0; sweep < kBatchedJacobiMaxSweeps; ++sweep) {
+        std::fill(off.begin(), off.end(), Real{0});
+        std::fill(total.begin(), total.end(), Real{0});
+        for (IndexType i = 0; i < size; ++i) {
+            for (IndexType j = 0; j < size; ++j) {
+                auto &acc = (i == j) ? total : off;
+                const auto *x = D.Lanes(i, j) + from;
+                for (IndexType b = 0; b < lanes; ++b) {
+                    acc[b] += std::norm(x[b]);
+                }
+            }
+        }
+
+        bool converged = true;
+        for (IndexType b = 0; b < lanes; ++b) {
+            converged &=
+                std::sqrt(off[b]) <= tol * std::sqrt(off[b] + total[b]);
+        }
+        if (converged) {
+            break;
+        }
+
+        for (IndexType p = 0; p < size; ++p) {
+            for (IndexType q = p + 1; q < size; ++q) {
+                const auto *a = D.Lanes(p, p) + from;
+                const auto *d = D.Lanes(q, q) + from;
+                const auto *g = D.Lanes(p, q) + from;
+                for (IndexType b = 0; b < lanes; ++b) {
+                    GetHermitianJacobiRotation(std::real(a[b]),
+                                               std::real(d[b]), g[b], c[b],
+                                               s[b], e[b]);
+                }
+
+                RotateBatchedColumns(D, p, q, from, to, c, s, e);
+                RotateBatchedColumns(U, p, q, from, to, c, s, e);
+
+                // D = W^H * D.
+                for (IndexType j = 0; j < size; ++j) {
+                    auto *first = D.Lanes(p, j) + from;
+                    auto *second = D.Lanes(q, j) + from;
+                    for (IndexType b = 0; b < lanes; ++b) {
+                        auto lhs = first[b];
+                        auto rhs = e[b] * second[b];
+                        first[b] = c[b] * lhs - s[b] * rhs;
+                        second[b] = s[b] * lhs + c[b] * rhs;
+                    }
+                }
+
+                std::fill_n(D.Lanes(p, q) + from, lanes, T{0});
+                std::fill_n(D.Lanes(q, p) + from, lanes, T{0});
+            }
+        }
+    }
+
+    for (IndexType i = 0; i < size; ++i) {
+        for (IndexType j = 0; j < size; ++j) {
+            auto *x = D.Lanes(i, j) + from;
+            for (IndexType b = 0; b < lanes; ++b) {
+                x[b] = (i == j) ? T{std::real(x[b])} : T{0};
+            }
+        }
+    }
+}
+
+// One-sided Jacobi for the lanes [from, to) of W with rows >= cols: the
+// columns of W become orthogonal, the rotations go to V, and then the
+// columns of both are sorted by the norm of the columns of W.
+template <Utils::FloatOrComplex T>
+void BatchedOneSidedJacobi(MatrixBatch<T> &W, MatrixBatch<T> &V,
+                           IndexType from, IndexType to) {
+    using Real = Utils::RealType<T>;
+
+    auto rows = W.Rows();
+    auto cols = W.Columns();
+    auto lanes = to - from;
+    auto tol = std::numeric_limits<Real>::epsilon() *
+               static_cast<Real>(std::max(rows, IndexType{1}));
+
+    std::vector<Real> c(lanes);
+    std::vector<Real> s(lanes);
+    std::vector<T> e(lanes);
+    std::vector<Real> alpha(lanes);
+    std::vector<Real> beta(lanes);
+    std::vector<T> gamma(lanes);
+
+    for (IndexType sweep = 0; sweep < kBatchedJacobiMaxSweeps; ++sweep) {
+        bool converged = true;
+
+        for (IndexType p = 0; p < cols; ++p) {
+            for (IndexType q = p + 1; q < cols; ++q) {
+                std::fill(alpha.begin(), alpha.end(), Real{0});
+                std::fill(beta.begin(), beta.end(), Real{0});
+                std::fill(gamma.begin(), gamma.end(), T{0});
+                for (IndexType i = 0; i < rows; ++i) {
+                    const auto *first = W.Lanes(i, p) + from;
+                    const auto *second = W.Lanes(i, q) + from;
+                    for (IndexType b = 0; b < lanes; ++b) {
+                        alpha[b] += std::norm(first[b]);
+                        beta[b] += std::norm(second[b]);
+                        gamma[b] += Utils::Conj(first[b]) * second[b];
+                    }
+                }
+
+                for (IndexType b = 0; b < lanes; ++b) {
+                    converged &= std::abs(gamma[b]) <=
+                                 tol * std::sqrt(alpha[b] * beta[b]);
+                    GetHermitianJacobiRotation(alpha[b], beta[b], gamma[b],
+                                               c[b], s[b], e[b]);
+                }
+
+                RotateBatchedColumns(W, p, q, from, to, c, s, e);
+                RotateBatchedColumns(V, p, q, from, to, c, s, e);
+            }
+        }
+
+        if (converged) {
+            break;
+        }
+    }
+
+    // Selection sort of the few columns, lane by lane.
+    std::vector<Real> norms(cols);
+    for (IndexType b = from; b < to; ++b) {
+        for (IndexType j = 0; j < cols; ++j) {
+            norms[j] = 0;
+            for (IndexType i = 0; i < rows; ++i) {
+                norms[j] += std::norm(W(b, i, j));
+            }
+        }
+
+        for (IndexType j = 0; j < cols; ++j) {
+            auto best = j;
+            for (IndexType k = j + 1; k < cols; ++k) {
+                best = (norms[k] > norms[best]) ? k : best;
+            }
+            if (best == j) {
+                continue;
+            }
+
+            std::swap(norms[j], norms[best]);
+            for (IndexType i = 0; i < rows; ++i) {
+                std::swap(W(b, i, j), W(b, i, best));
+            }
+            for (IndexType i = 0; i < cols; ++i) {
+                std::swap(V(b, i, j), V(b, i, best));
+            }
+        }
+    }
+}
+
+template <Utils::FloatOrComplex T>
+MatrixBatch<T> GetAdjointBatch(const MatrixBatch<T> &A) {
+    MatrixBatch<T> result(A.Count(), A.Columns(), A.Rows());
+    for (IndexType i = 0; i < A.Rows(); ++i) {
+        for (IndexType j = 0; j < A.Columns(); ++j) {
+            const auto *x = A.Lanes(i, j);
+            auto *y = result.Lanes(j, i);
+            for (IndexType b = 0; b < A.Count(); ++b) {
+                y[b] = Utils::Conj(x[b]);
+            }
+        }
+    }
+
+    return result;
+}
+} // namespace Details
+
+// A = Q * R for every matrix of the batch, with square unitary Q.
+template <Utils::FloatOrComplex T>
+Details::BatchedPairQR<T> BatchedQR(const MatrixBatch<T> &batch) {
+    auto Q = MatrixBatch<T>::Identity(batch.Count(), batch.Rows());
+    auto R = batch;
+
+    Details::ForEachBatchChunk(batch.Count(), [&](IndexType from,
+                                                  IndexType to) {
+        Details::BatchedHouseholderQR(Q, R, from, to);
+    });
+
+    return {std::move(Q), std::move(R)};
+}
+
+// A = U * D * U^H for every Hermitian matrix of the batch by the cyclic
+// Jacobi method. The eigenvalues are not sorted.
+template <Utils::FloatOrComplex T>
+Details::BatchedSpectralPair<T> BatchedSpec(const MatrixBatch<T> &batch) {
+    assert(batch.Rows() == batch.Columns() &&
+           "Spectral decomposition for square matrices.");
+
+    auto D = batch;
+    auto U = MatrixBatch<T>::Identity(batch.Count(), batch.Rows());
+
+    Details::ForEachBatchChunk(batch.Count(), [&](IndexType from,
+                                                  IndexType to) {
+        Details::BatchedJacobiEigen(D, U, from, to);
+    });
+
+    return {std::move(D), std::move(U)};
+}
+
+// A = U * diag(S) * VT for every matrix of the batch as in SVD: S is the row
+// of min(rows, cols) singular values in descending order. The one-sided
+// Jacobi method makes the columns of A * V orthogonal, and the QR
+// factorization of them gives the full U.
+template <Utils::FloatOrComplex T>
+Details::BatchedSingularBasis<T> BatchedSVD(const MatrixBatch<T> &batch) {
+    if (batch.Rows() < batch.Columns()) {
+        auto [U, S, VT] = BatchedSVD(Details::GetAdjointBatch(batch));
+        return {Details::GetAdjointBatch(VT), std::move(S),
+                Details::GetAdjointBatch(U)};
+    }
+
+    auto count = batch.Count();
+    auto rows = batch.Rows();
+    auto cols = batch.Columns();
+
+    auto W = batch;
+    auto V = MatrixBatch<T>::Identity(count, cols);
+    auto U = MatrixBatch<T>::Identity(count, rows);
+    MatrixBatch<T> S(count, 1, cols);
+
+    Details::ForEachBatchChunk(count, [&](IndexType from, IndexType to) {
+        Details::BatchedOneSidedJacobi(W, V, from, to);
+        Details::BatchedHouseholderQR(U, W, from, to);
+
+        // The columns of W were orthogonal, so R is diagonal, and its
+        // phases go to U.
+        for (IndexType j = 0; j < cols; ++j) {
+            auto *r = W.Lanes(j, j) + from;
+            auto *sigma = S.Lanes(0, j) + from;
+            for (IndexType b = 0; b < to - from; ++b) {
+                auto abs_r = std::abs(r[b]);
+                sigma[b] = abs_r;
+                r[b] = (abs_r > 0) ? r[b] / abs_r : T{1};
+            }
+            for (IndexType i = 0; i < rows; ++i) {
+                auto *u = U.Lanes(i, j) + from;
+                for (IndexType b = 0; b < to - from; ++b) {
+                    u[b] *= r[b];
+                }
+            }
+        }
+    });
+
+    return {std::move(U), std::move(S), Details::GetAdjointBatch(V)};
+}
+} // namespace LinearKit::Algorithm
@@ -0,0 +1,556 @@
+#pragma once
+
+#include "../matrix_utils/checks.h"
+#include "../utils/thread_pool.h"
+#include "jacobi_svd.h"
+#include "qr_algorithm_bidiag.h"
+
+#include <numeric>
+#include <optional>
+#include <vector>
+
+namespace LinearKit::Algorithm {
+namespace Details {
+template <Utils::FloatOrComplex T>
+struct SplitSingularBasis {
+    Matrix<T> U;
+    std::vector<T> sigma;
+    Matrix<T> V;
+};
+
+inline constexpr IndexType kDivideConquerLeafSize = 16;
+
+// The safeguarded iteration for a secular root normally ends in a few steps;
+// this only bounds the bisection fallback.
+inline constexpr IndexType kSecularMaxIterations = 256;
+
+template <Utils::FloatOrComplex T>
+void CopyBlock(Matrix<T> &dst, IndexType row, IndexType col,
+               const Matrix<T> &src) {
+    for (IndexType i = 0; i < src.Rows(); ++i) {
+        for (IndexType j = 0; j < src.Columns(); ++j) {
+            dst(row + i, col + j) = src(i, j);
+        }
+    }
+}
+
+template <Utils::FloatOrComplex T>
+void RotateColumns(Matrix<T> &matrix, IndexType first, IndexType second,
+                   T cos, T sin) {
+    for (IndexType i = 0; i < matrix.Rows(); ++i) {
+        auto lhs = matrix(i, first);
+        auto rhs = matrix(i, second);
+
+        matrix(i, first) = cos * lhs - sin * rhs;
+        matrix(i, second) = sin * lhs + cos * rhs;
+    }
+}
+
+// Secular equation 1 + sum(z_i^2 / (d_i^2 - s^2)) = 0. The root is stored as
+// an offset from the nearest pole, so differences with poles stay accurate.
+template <Utils::FloatOrComplex T>
+class SecularRoots {
+public:
+    SecularRoots(std::vector<T> d, std::vector<T> z)
+        : d_(std::move(d)), z_(std::move(z)), base_(d_.size()),
+          tau_(d_.size()) {
+        T z_norm = 0;
+        for (auto val : z_) {
+            z_norm += val * val;
+        }
+
+        Utils::ParallelFor(0, Size(), [&](std::ptrdiff_t j) {
+            FindRoot(j, z_norm);
+        }, 16);
+    }
+
+    [[nodiscard]] IndexType Size() const {
+        return d_.size();
+    }
+
+    T Singular(IndexType j) const {
+        return d_[base_[j]] + tau_[j];
+    }
+
+    // Returns s_j^2 - d_i^2.
+    T Difference(IndexType j, IndexType i) const {
+        auto pole = d_[base_[j]];
+        return ((pole - d_[i]) + tau_[j]) * (pole + tau_[j] + d_[i]);
+    }
+
+    // Gu-Eisenstat vector which makes the computed roots exact, so singular
+    // vectors built from it are orthogonal.
+    std::vector<T> GetCorrectedVector() const {
+        std::vector<T> z_hat(Size());
+
+        for (IndexType i = 0; i < Size(); ++i) {
+            auto prod = Difference(Size() - 1, i);
+            for (IndexType j = 0; j < i; ++j) {
+                prod *= Difference(j, i) / ((d_[j] - d_[i]) * (d_[j] + d_[i]));
+            }
+
+            for (IndexType j = i; j + 1 < Size(); ++j) {
+                prod *= Difference(j, i) /
+                        ((d_[j + 1] - d_[i]) * (d_[j + 1] + d_[i]));
+            }
+
+            z_hat[i] = std::copysign(std::sqrt(std::abs(prod)), z_[i]);
+        }
+
+        return z_hat;
+    }
+
+private:
+    // f(s) with s = d_base + tau, split by the poles of the interval
+    // (d_j, d_j+1): psi over i <= j, phi over i > j. The derivatives are taken
+    // in s^2, bound is the scale of the rounding errors in f.
+    struct SecularValue {
+        T f = 1;
+        T psi_der = 0;
+        T phi_der = 0;
+        T bound = 1;
+    };
+
+    SecularValue Evaluate(IndexType j, IndexType base, T tau) const {
+        SecularValue value;
+        for (IndexType i = 0; i < Size(); ++i) {
+            auto delta = ((d_[i] - d_[base]) - tau) * (d_[i] + d_[base] + tau);
+            auto term = z_[i] * z_[i] / delta;
+
+            value.f += term;
+            value.bound += std::abs(term);
+            if (i <= j) {
+                value.psi_der += term / delta;
+            } else {
+                value.phi_der += term / delta;
+            }
+        }
+        return value;
+    }
+
+    // Middle way of LAPACK dlasd4: psi and phi are replaced by
+    // c + s / (delta_j - eta) + S / (delta_j+1 - eta), matching f and the
+    // derivatives at the current point, and the root of that rational function
+    // gives the step eta in s^2. Returns the new tau, or nothing if the step
+    // leaves the interval.
+    std::optional<T> RationalStep(IndexType j, IndexType base, T tau,
+                                  const SecularValue &value) const {
+        auto sigma = d_[base] + tau;
+        auto delta_l = ((d_[j] - d_[base]) - tau) * (d_[j] + sigma);
+        auto s = value.psi_der * delta_l * delta_l;
+        auto c = value.f - value.psi_der * delta_l;
+
+        T eta = 0;
+        if (j + 1 == Size()) {
+            if (c <= T{0}) {
+                return std::nullopt;
+            }
+            eta = delta_l + s / c;
+        } else {
+            auto delta_r = ((d_[j + 1] - d_[base]) - tau) * (d_[j + 1] + sigma);
+            auto S = value.phi_der * delta_r * delta_r;
+            c -= value.phi_der * delta_r;
+
+            // c * eta^2 - a * eta + b = 0 with the root in (delta_l, delta_r).
+            auto a = c * (delta_l + delta_r) + s + S;
+            auto b = c * delta_l * delta_r + s * delta_r + S * delta_l;
+            if (c == T{0}) {
+                eta = b / a;
+            } else {
+                auto disc = a * a - T{4} * b * c;
+                if (disc < T{0}) {
+                    return std::nullopt;
+                }
+                auto q = (a + std::copysign(std::sqrt(disc), a)) / T{2};
+                eta = q / c;
+                if (!(eta > delta_l && eta < delta_r) && q != T{0}) {
+                    eta = b / q;
+                }
+            }
+            if (!(eta < delta_r)) {
+                return std::nullopt;
+            }
+        }
+
+        if (!(eta > delta_l) || sigma * sigma + eta < T{0}) {
+            return std::nullopt;
+        }
+        return tau + eta / (sigma + std::sqrt(sigma * sigma + eta));
+    }
+
+    // The rational steps converge quadratically; a step that leaves the
+    // bracket of the root or does not halve |f| is replaced by bisection. The
+    // iteration ends when |f| is at the level of its rounding errors or the
+    // bracket cannot be split any more.
+    void FindRoot(IndexType j, T z_norm) {
+        // The last root is at most sqrt(d_j^2 + |z|^2), the bound is taken
+        // without cancellation since z may be far below d_j.
+        auto is_last = (j + 1 == Size());
+        auto gap = is_last
+                       ? z_norm / (d_[j] + std::sqrt(d_[j] * d_[j] + z_norm))
+                       : d_[j + 1] - d_[j];
+        auto half = gap / T{2};
+
+        T from = 0;
+        T to = half;
+        base_[j] = j;
+
+        if (is_last) {
+            to = gap;
+        } else if (Evaluate(j, j, half).f < T{0}) {
+            base_[j] = j + 1;
+            from = half - gap;
+            to = 0;
+        }
+
+        auto eps = std::numeric_limits<T>::epsilon();
+        auto tau = from + (to - from) / T{2};
+        auto last_f = std::numeric_limits<T>::infinity();
+
+        for (IndexType it = 0; it < kSecularMaxIterations; ++it) {
+            auto value = Evaluate(j, base_[j], tau);
+            if (std::abs(value.f) <= eps * value.bound) {
+                break;
+            }
+
+            if (value.f > T{0}) {
+                to = tau;
+            } else {
+                from = tau;
+            }
+
+            auto mid = from + (to - from) / T{2};
+            if (mid <= from || mid >= to) {
+                break;
+            }
+
+            auto next = mid;
+            if (std::abs(value.f) <= std::abs(last_f) / T{2}) {
+                auto step = RationalStep(j, base_[j], tau, value);
+                if (step && *step > from && *step < to) {
+                    next = *step;
+                }
+            }
+            last_f = value.f;
+
+            if (next == tau) {
+                break;
+            }
+            tau = next;
+        }
+
+        tau_[j] = tau;
+    }
+
+    std::vector<T> d_;
+    std::vector<T> z_;
+    std::vector<IndexType> base_;
+    std::vector<T> tau_;
+};
+
+// SVD of M = e_0 z^T + diag(d), where d_0 = 0.
+template <Utils::FloatOrComplex T>
+SplitSingularBasis<T> ArrowSVD(std::vector<T> d, std::vector<T> z) {
+    IndexType size = d.size();
+
+    SplitSingularBasis<T> result{Matrix<T>::Identity(size),
+                                 std::vector<T>(size, T{0}),
+                                 Matrix<T>::Identity(size)};
+
+    T scale = 0;
+    for (IndexType i = 0; i < size; ++i) {
+        scale = std::max({scale, std::abs(d[i]), std::abs(z[i])});
+    }
+
+    if (scale == T{0}) {
+        return result;
+    }
+
+    auto tol = T{8} * std::numeric_limits<T>::epsilon() * scale;
+    auto &U = result.U;
+    auto &V = result.V;
+    std::vector<IndexType> deflated;
+
+    if (std::abs(z[0]) <= tol) {
+        z[0] = tol;
+    }
+
+    for (IndexType i = 1; i < size; ++i) {
+        if (d[i] > tol) {
+            continue;
+        }
+
+        // Zero pole: the column rotation moves z_i into z_0.
+        auto norm = std::hypot(z[0], z[i]);
+        RotateColumns(V, 0, i, z[0] / norm, -z[i] / norm);
+        z[0] = norm;
+        z[i] = d[i] = T{0};
+        deflated.push_back(i);
+    }
+
+    std::vector<IndexType> order;
+    for (IndexType i = 1; i < size; ++i) {
+        if (d[i] != T{0} || z[i] != T{0}) {
+            order.push_back(i);
+        }
+    }
+
+    std::stable_sort(order.begin(), order.end(),
+                     [&](auto lhs, auto rhs) { return d[lhs] < d[rhs]; });
+
+    std::vector<IndexType> kept = {0};
+    for (auto idx : order) {
+        if (std::abs(z[idx]) <= tol) {
+            deflated.push_back(idx);
+            continue;
+        }
+
+        auto prev = kept.back();
+        if (prev != 0 && d[idx] - d[prev] <= tol) {
+            // Close poles: the rotation moves z_prev into z_idx.
+            auto norm = std::hypot(z[prev], z[idx]);
+            auto cos = z[idx] / norm;
+            auto sin = z[prev] / norm;
+
+            RotateColumns(U, prev, idx, cos, sin);
+            RotateColumns(V, prev, idx, cos, sin);
+            z[idx] = norm;
+            z[prev] = T{0};
+
+            kept.back() = idx;
+            deflated.push_back(prev);
+            continue;
+        }
+
+        kept.push_back(idx);
+    }
+
+    IndexType kept_cnt = kept.size();
+    std::vector<T> d_kept(kept_cnt);
+    std::vector<T> z_kept(kept_cnt);
+    for (IndexType i = 0; i < kept_cnt; ++i) {
+        d_kept[i] = d[kept[i]];
+        z_kept[i] = z[kept[i]];
+    }
+
+    SecularRoots<T> roots(d_kept, z_kept);
+    auto z_hat = roots.GetCorrectedVector();
+
+    Matrix<T> U_small(kept_cnt, kept_cnt);
+    Matrix<T> V_small(kept_cnt, kept_cnt);
+
+    Utils::ParallelFor(0, kept_cnt, [&](std::ptrdiff_t j) {
+        T u_norm = 0;
+        T v_norm = 0;
+
+        for (IndexType i = 0; i < kept_cnt; ++i) {
+            auto v_val = -z_hat[i] / roots.Difference(j, i);
+            auto u_val = (i == 0) ? T{-1} : d_kept[i] * v_val;
+
+            V_small(i, j) = v_val;
+            U_small(i, j) = u_val;
+            v_norm += v_val * v_val;
+            u_norm += u_val * u_val;
+        }
+
+        u_norm = std::sqrt(u_norm);
+        v_norm = std::sqrt(v_norm);
+        for (IndexType i = 0; i < kept_cnt; ++i) {
+            U_small(i, j) /= u_norm;
+            V_small(i, j) /= v_norm;
+        }
+    }, 16);
+
+    Matrix<T> U_kept(size, kept_cnt);
+    Matrix<T> V_kept(size, kept_cnt);
+    for (IndexType i = 0; i < size; ++i) {
+        for (IndexType j = 0; j < kept_cnt; ++j) {
+            U_kept(i, j) = U(i, kept[j]);
+            V_kept(i, j) = V(i, kept[j]);
+        }
+    }
+
+    Matrix<T> U_res(size, size);
+    Matrix<T> V_res(size, size);
+    CopyBlock(U_res, 0, 0, U_kept * U_small);
+    CopyBlock(V_res, 0, 0, V_kept * V_small);
+
+    for (IndexType j = 0; j < kept_cnt; ++j) {
+        result.sigma[j] = roots.Singular(j);
+    }
+
+    for (IndexType k = 0; k < static_cast<IndexType>(deflated.size()); ++k) {
+        auto idx = deflated[k];
+        auto col = kept_cnt + k;
+
+        result.sigma[col] = d[idx];
+        for (IndexType i = 0; i < size; ++i) {
+            U_res(i, col) = U(i, idx);
+            V_res(i, col) = V(i, idx);
+        }
+    }
+
+    result.U = std::move(U_res);
+    result.V = std::move(V_res);
+    return result;
+}
+
+// SVD of the upper bidiagonal block with rows [from, from + rows), which has
+// one extra column if is_extended is set. In that case the last column of V
+// spans the null space of the block.
+template <Utils::FloatOrComplex T>
+SplitSingularBasis<T> DivideConquerStep(const std::vector<T> &d,
+                                        const std::vector<T> &e,
+                                        IndexType from, IndexType rows,
+                                        bool is_extended) {
+    auto cols = rows + (is_extended ? 1 : 0);
+
+    if (rows <= kDivideConquerLeafSize) {
+        Matrix<T> block(rows, cols);
+        for (IndexType i = 0; i < rows; ++i) {
+            block(i, i) = d[from + i];
+            if (i + 1 < cols) {
+                block(i, i + 1) = e[from + i];
+            }
+        }
+
+        auto [U, S, VT, sweeps, is_converged] = JacobiSVD(block);
+        std::vector<T> sigma(rows);
+        for (IndexType i = 0; i < rows; ++i) {
+            sigma[i] = S(0, i);
+        }
+
+        return {std::move(U), std::move(sigma), Matrix<T>::Transposed(VT)};
+    }
+
+    auto mid = rows / 2;
+    auto low_rows = rows - mid - 1;
+
+    SplitSingularBasis<T> halves[2];
+    Utils::ParallelFor(0, 2, [&](std::ptrdiff_t idx) {
+        halves[idx] = (idx == 0) ? DivideConquerStep(d, e, from, mid, true)
+                                 : DivideConquerStep(d, e, from + mid + 1,
+                                                     low_rows, is_extended);
+    });
+
+    const auto &[U1, sigma1, V1] = halves[0];
+    const auto &[U2, sigma2, V2] = halves[1];
+
+    auto alpha = d[from + mid];
+    auto beta = e[from + mid];
+    auto first_null = alpha * V1(mid, mid);
+    auto second_null = is_extended ? beta * V2(0, low_rows) : T{0};
+
+    T cos = 1;
+    T sin = 0;
+    auto z_0 = std::hypot(first_null, second_null);
+    if (z_0 != T{0}) {
+        cos = first_null / z_0;
+        sin = second_null / z_0;
+    }
+
+    // Middle row goes first, then the singular values of both halves.
+    std::vector<T> d_arrow(rows, T{0});
+    std::vector<T> z_arrow(rows, T{0});
+    z_arrow[0] = z_0;
+
+    for (IndexType i = 0; i < mid; ++i) {
+        d_arrow[i + 1] = sigma1[i];
+        z_arrow[i + 1] = alpha * V1(mid, i);
+    }
+
+    for (IndexType i = 0; i < low_rows; ++i) {
+        d_arrow[mid + 1 + i] = sigma2[i];
+        z_arrow[mid + 1 + i] = beta * V2(0, i);
+    }
+
+    auto [U_hat, sigma, V_hat] = ArrowSVD(d_arrow, z_arrow);
+
+    Matrix<T> U(rows, rows);
+    CopyBlock(U, 0, 0, U1 * U_hat.GetSubmatrix({1, mid + 1}, {0, rows}));
+    CopyBlock(U, mid, 0, Matrix<T>(U_hat.GetSubmatrix({0, 1}, {0, rows})));
+    CopyBlock(U, mid + 1, 0,
+              U2 * U_hat.GetSubmatrix({mid + 1, rows}, {0, rows}));
+
+    Matrix<T> V1_arrow(mid + 1, mid + 1);
+    Matrix<T> V2_arrow(V2.Rows(), low_rows + 1);
+    Matrix<T> V_hat_low(low_rows + 1, rows);
+
+    for (IndexType i = 0; i <= mid; ++i) {
+        V1_arrow(i, 0) = cos * V1(i, mid);
+        for (IndexType j = 0; j < mid; ++j) {
+            V1_arrow(i, j + 1) = V1(i, j);
+        }
+    }
+
+    for (IndexType i = 0; i < V2.Rows(); ++i) {
+        V2_arrow(i, 0) = is_extended ? sin * V2(i, low_rows) : T{0};
+        for (IndexType j = 0; j < low_rows; ++j) {
+            V2_arrow(i, j + 1) = V2(i, j);
+        }
+    }
+
+    for (IndexType j = 0; j < rows; ++j) {
+        V_hat_low(0, j) = V_hat(0, j);
+        for (IndexType i = 0; i < low_rows; ++i) {
+            V_hat_low(i + 1, j) = V_hat(mid + 1 + i, j);
+        }
+    }
+
+    Matrix<T> V(cols, cols);
+    CopyBlock(V, 0, 0, V1_arrow * V_hat.GetSubmatrix({0, mid + 1}, {0, rows}));
+    CopyBlock(V, mid + 1, 0, V2_arrow * V_hat_low);
+
+    if (is_extended) {
+        for (IndexType i = 0; i <= mid; ++i) {
+            V(i, rows) = -sin * V1(i, mid);
+        }
+
+        for (IndexType i = 0; i < V2.Rows(); ++i) {
+            V(mid + 1 + i, rows) = cos * V2(i, low_rows);
+        }
+    }
+
+    return {std::move(U), std::move(sigma), std::move(V)};
+}
+} // namespace Details
+
+template <MatrixUtils::MatrixType M>
+Details::DiagBasisQR<typename M::ElemType> BidiagDivideConquer(const M &B) {
+    using T = typename M::ElemType;
+
+    static_assert(!Utils::Details::IsFloatComplexT<T>::value,
+                  "Divide and conquer for real bidiagonal matrices.");
+    static_assert(Utils::StandardFloatOrComplex<T>,
+                  "Divide and conquer for the standard floating types.");
+    assert(B.Rows() >= B.Columns() && MatrixUtils::IsBidiagonal(B) &&
+           "Divide and conquer for upper bidiagonal matrices.");
+
+    auto size = B.Columns();
+    Matrix<T> D(B.Rows(), size);
+    Matrix<T> U = Matrix<T>::Identity(B.Rows());
+
+    if (size == 0) {
+        return {std::move(U), std::move(D), Matrix<T>()};
+    }
+
+    std::vector<T> d(size);
+    std::vector<T> e(size, T{0});
+    for (IndexType i = 0; i < size; ++i) {
+        d[i] = B(i, i);
+        if (i + 1 < size) {
+            e[i] = B(i, i + 1);
+        }
+    }
+
+    auto [U_sq, sigma, V] = Details::DivideConquerStep(d, e, 0, size, false);
+
+    Details::CopyBlock(U, 0, 0, U_sq);
+    for (IndexType i = 0; i < size; ++i) {
+        D(i, i) = sigma[i];
+    }
+
+    V.Transpose();
+    return {std::move(U), std::move(D), std::move(V)};
+}
+} // namespace LinearKit::Algorithm
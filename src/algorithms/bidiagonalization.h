@@ -3,6 +3,8 @@
 #include "../matrix_utils/is_matrix_type.h"
 #include "householder.h"
 
+#include <vector>
+
 namespace LinearKit::Algorithm {
 namespace Details {
 template <Utils::FloatOrComplex T = long double>
@@ -16,12 +18,12 @@ template <MatrixUtils::MutableMatrixType F, MatrixUtils::MutableMatrixType S>
 void RowToReal(F &B, S &U, IndexType idx) {
     using T = F::ElemType;
 
-    auto norm = std::abs(B(idx, idx));
+    auto norm = Utils::Abs(B(idx, idx));
     if (Utils::IsZeroFloating(norm)) {
         return;
     }
 
-    auto coeff = std::conj(B(idx, idx) / norm);
+    auto coeff = Utils::Conj(B(idx, idx) / norm);
     auto B_row = B.GetRow(idx);
     auto U_row = U.GetRow(idx);
 
@@ -33,18 +35,146 @@ template <MatrixUtils::MutableMatrixType F, MatrixUtils::MutableMatrixType S>
 void ColumnToReal(F &B, S &V, IndexType idx) {
     using T = F::ElemType;
 
-    auto norm = std::abs(B(idx, idx + 1));
+    auto norm = Utils::Abs(B(idx, idx + 1));
     if (Utils::IsZeroFloating(norm)) {
         return;
     }
 
-    auto coeff = std::conj(B(idx, idx + 1) / norm);
+    auto coeff = Utils::Conj(B(idx, idx + 1) / norm);
     auto B_row = B.GetColumn(idx + 1);
     auto V_col = V.GetColumn(idx + 1);
 
     B_row *= coeff;
     V_col *= coeff;
 }
+
+inline constexpr IndexType kBidiagBlockSize = 32;
+
+template <Utils::FloatOrComplex T>
+struct BidiagReflectors {
+    Matrix<T> left;
+    Matrix<T> right;
+    std::vector<T> tau_left;
+    std::vector<T> tau_right;
+};
+
+template <Utils::FloatOrComplex T>
+struct PanelAccumulators {
+    Matrix<T> X;
+    Matrix<T> Y;
+};
+
+// Reduces the rows and columns [from, from + width) of B, applying the
+// reflectors to the rest of the matrix only through the accumulators:
+// B - U * Y^H - X * V^H is the up to date trailing matrix.
+template <Utils::FloatOrComplex T>
+PanelAccumulators<T> ReduceBidiagPanel(Matrix<T> &B,
+                                       BidiagReflectors<T> &reflectors,
+                                       IndexType from, IndexType width) {
+    auto &[left, right, tau_left, tau_right] = reflectors;
+    auto rows = B.Rows();
+    auto cols = B.Columns();
+
+    Matrix<T> X(rows, width);
+    Matrix<T> Y(cols, width);
+    std::vector<T> proj_first(width);
+    std::vector<T> proj_second(width);
+
+    for (IndexType i = 0; i < width; ++i) {
+        auto c = from + i;
+
+        for (IndexType r = c; r < rows; ++r) {
+            for (IndexType k = 0; k < i; ++k) {
+                B(r, c) -= left(r, from + k) * Utils::Conj(Y(c, k)) +
+                           X(r, k) * Utils::Conj(right(c, from + k));
+            }
+            left(r, c) = B(r, c);
+        }
+
+        auto u = left.GetSubmatrix({c, rows}, {c, c + 1});
+        auto [tau, beta] = HouseholderGenerate(u);
+        tau_left[c] = tau;
+
+        B(c, c) = beta;
+        for (IndexType r = c + 1; r < rows; ++r) {
+            B(r, c) = T{0};
+        }
+
+        if (c + 1 >= cols) {
+            continue;
+        }
+
+        for (IndexType k = 0; k < i; ++k) {
+            proj_first[k] = proj_second[k] = T{0};
+            for (IndexType r = c; r < rows; ++r) {
+                proj_first[k] += Utils::Conj(left(r, from + k)) * left(r, c);
+                proj_second[k] += Utils::Conj(X(r, k)) * left(r, c);
+            }
+        }
+
+        for (IndexType j = c + 1; j < cols; ++j) {
+            T sum = 0;
+            for (IndexType r = c; r < rows; ++r) {
+                sum += Utils::Conj(B(r, j)) * left(r, c);
+            }
+
+            for (IndexType k = 0; k < i; ++k) {
+                sum -= Y(j, k) * proj_first[k] +
+                       right(j, from + k) * proj_second[k];
+            }
+            Y(j, i) = tau * sum;
+        }
+
+        for (IndexType j = c + 1; j < cols; ++j) {
+            for (IndexType k = 0; k <= i; ++k) {
+                B(c, j) -= left(c, from + k) * Utils::Conj(Y(j, k));
+            }
+
+            for (IndexType k = 0; k < i; ++k) {
+                B(c, j) -= X(c, k) * Utils::Conj(right(j, from + k));
+            }
+
+            right(j, c) = Utils::Conj(B(c, j));
+        }
+
+        auto w = right.GetSubmatrix({c + 1, cols}, {c, c + 1});
+        auto [tau_row, beta_row] = HouseholderGenerate(w);
+        tau_right[c] = tau_row;
+
+        B(c, c + 1) = beta_row;
+        for (IndexType j = c + 2; j < cols; ++j) {
+            B(c, j) = T{0};
+        }
+
+        for (IndexType k = 0; k <= i; ++k) {
+            proj_first[k] = proj_second[k] = T{0};
+            for (IndexType j = c + 1; j < cols; ++j) {
+                proj_first[k] += Utils::Conj(Y(j, k)) * right(j, c);
+                if (k < i) {
+                    proj_second[k] +=
+                        Utils::Conj(right(j, from + k)) * right(j, c);
+                }
+            }
+        }
+
+        for (IndexType r = c + 1; r < rows; ++r) {
+            T sum = 0;
+            for (IndexType j = c + 1; j < cols; ++j) {
+                sum += B(r, j) * right(j, c);
+            }
+
+            for (IndexType k = 0; k <= i; ++k) {
+                sum -= left(r, from + k) * proj_first[k];
+                if (k < i) {
+                    sum -= X(r, k) * proj_second[k];
+                }
+            }
+            X(r, i) = tau_row * sum;
+        }
+    }
+
+    return {std::move(X), std::move(Y)};
+}
 } // namespace Details
 
 using IndexType = LinearKit::Details::Types::IndexType;
@@ -87,4 +217,55 @@ Details::BidiagonalBasis<typename M::ElemType> Bidiagonalize(const M &matrix) {
     B.RoundZeroes();
     return {std::move(U), std::move(B), std::move(V)};
 }
+
+// Blocked variant of Bidiagonalize: the trailing matrix is updated once per
+// panel by two matrix products, and U, VT are formed from the stored
+// reflectors at the end.
+template <MatrixUtils::MatrixType M>
+Details::BidiagonalBasis<typename M::ElemType>
+BlockedBidiagonalize(const M &matrix,
+                     IndexType block = Details::kBidiagBlockSize) {
+    using T = typename M::ElemType;
+
+    assert(block > 0 && "Block size must be positive.");
+
+    Matrix<T> B = matrix;
+    auto rows = B.Rows();
+    auto cols = B.Columns();
+    auto steps = std::min(rows, cols);
+
+    Details::BidiagReflectors<T> reflectors{
+        Matrix<T>(rows, steps), Matrix<T>(cols, steps),
+        std::vector<T>(steps, T{0}), std::vector<T>(steps, T{0})};
+
+    for (IndexType from = 0; from < steps; from += block) {
+        auto width = std::min(block, steps - from);
+        auto [X, Y] = Details::ReduceBidiagPanel(B, reflectors, from, width);
+
+        auto next = from + width;
+        if (next >= rows || next >= cols) {
+            continue;
+        }
+
+        const auto &left = reflectors.left;
+        const auto &right = reflectors.right;
+        auto trailing = B.GetSubmatrix({next, rows}, {next, cols});
+
+        trailing -=
+            left.GetSubmatrix({next, rows}, {from, next}) *
+            Matrix<T>::Conjugated(Y.GetSubmatrix({next, cols}, {0, width}));
+        trailing -= X.GetSubmatrix({next, rows}, {0, width}) *
+                    Matrix<T>::Conjugated(
+                        right.GetSubmatrix({next, cols}, {from, next}));
+    }
+
+    auto U = AccumulateReflectors(reflectors.left, reflectors.tau_left, 0,
+                                  block);
+    auto VT = AccumulateReflectors(reflectors.right, reflectors.tau_right, 1,
+                                   block);
+
+    VT.Conjugate();
+    B.RoundZeroes();
+    return {std::move(U), std::move(B), std::move(VT)};
+}
 } // namespace LinearKit::Algorithm
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "../matrix_utils/is_matrix_type.h"
+#include "../utils/sign.h"
+#include "../utils/thread_pool.h"
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace LinearKit::Algorithm {
+using IndexType = LinearKit::Details::Types::IndexType;
+
+namespace Details {
+// Rows of the output given to one task of the thread pool.
+inline constexpr IndexType kGemmRowGrain = 16;
+
+// The lowest and the highest address of the entries of a non-empty matrix.
+// The address is affine in the indices, so the ends are at the corners.
+template <MatrixUtils::MatrixType M>
+auto GetAddressRange(const M &A) {
+    auto last_row = A.Rows() - 1;
+    auto last_col = A.Columns() - 1;
+    auto corners = {A.GetAddress(0, 0), A.GetAddress(last_row, 0),
+                    A.GetAddress(0, last_col),
+                    A.GetAddress(last_row, last_col)};
+    return std::minmax(corners, std::less<>{});
+}
+
+// True if every entry of A is stored apart from C, or, with allow_same, if
+// A is C itself entry by entry. Only the dynamic matrices and their views
+// can share the storage. The address ranges are compared first, the entries
+// only if the ranges overlap.
+template <MatrixUtils::MatrixType M, MatrixUtils::MatrixType N>
+bool IsSameOrDisjoint(const M &A, const N &C, bool allow_same) {
+    if constexpr (!requires { A.GetAddress(0, 0); } ||
+                  !requires { C.GetAddress(0, 0); }) {
+        return true;
+    } else {
+        if (A.Rows() == 0 || A.Columns() == 0 || C.Rows() == 0 ||
+            C.Columns() == 0) {
+            return true;
+        }
+
+        auto [a_first, a_last] = GetAddressRange(A);
+        auto [c_first, c_last] = GetAddressRange(C);
+        if (std::less<>{}(a_last, c_first) || std::less<>{}(c_last, a_first)) {
+            return true;
+        }
+
+        auto same = allow_same && A.Rows() == C.Rows() &&
+                    A.Columns() == C.Columns();
+        for (IndexType i = 0; same && i < A.Rows(); ++i) {
+            for (IndexType j = 0; same && j < A.Columns(); ++j) {
+                same = A.GetAddress(i, j) == C.GetAddress(i, j);
+            }
+        }
+        if (same) {
+            return true;
+        }
+
+        std::unordered_set<const void *> entries;
+        for (IndexType i = 0; i < C.Rows(); ++i) {
+            for (IndexType j = 0; j < C.Columns(); ++j) {
+                entries.insert(C.GetAddress(i, j));
+            }
+        }
+        for (IndexType i = 0; i < A.Rows(); ++i) {
+            for (IndexType j = 0; j < A.Columns(); ++j) {
+                if (entries.contains(A.GetAddress(i, j))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+// The output of the routines below: a mutable matrix or a view, passed by
+// reference or as a temporary view.
+template <typename O>
+concept OutputMatrixType =
+    MatrixUtils::MutableMatrixType<std::remove_reference_t<O>>;
+
+template <typename O>
+using OutputElemType = typename std::remove_cvref_t<O>::ElemType;
+} // namespace Details
+
+// C = alpha * A * B + beta * C in the storage of C. A and B are read through
+// their operator(), so transposed and conjugated views are used as they are.
+// The products accumulate in Utils::WideType; with beta == 0 the old values
+// of C are not read. A must be C itself or disjoint from it, B must be
+// disjoint from C.
+template <MatrixUtils::MatrixType F, MatrixUtils::MatrixType S,
+          Details::OutputMatrixType O,
+          Utils::FloatOrComplex T = Details::OutputElemType<O>>
+void Gemm(std::type_identity_t<T> alpha, const F &A, const S &B,
+          std::type_identity_t<T> beta, O &&C) {
+    using W = Utils::WideType<T>;
+
+    assert(A.Columns() == B.Rows() && "Matrix multiplication mismatch.");
+    assert(C.Rows() == A.Rows() && C.Columns() == B.Columns() &&
+           "Wrong output size.");
+    assert(Details::IsSameOrDisjoint(A, C, true) &&
+           "A must be C itself or disjoint from it.");
+    assert(Details::IsSameOrDisjoint(B, C, false) &&
+           "B must be disjoint from C.");
+
+    auto cols = C.Columns();
+    Utils::ParallelFor(
+        0, C.Rows(),
+        [&](std::ptrdiff_t i) {
+            thread_local std::vector<W> row;
+            row.assign(cols, W{0});
+            for (IndexType k = 0; k < A.Columns(); ++k) {
+                auto coeff = static_cast<W>(A(i, k));
+                if (coeff == W{0}) {
+                    continue;
+                }
+                for (IndexType j = 0; j < cols; ++j) {
+                    row[j] += coeff * static_cast<W>(B(k, j));
+                }
+            }
+
+            for (IndexType j = 0; j < cols; ++j) {
+                auto value = static_cast<W>(alpha) * row[j];
+                if (beta != T{0}) {
+                    value += static_cast<W>(beta) * static_cast<W>(C(i, j));
+                }
+                C(i, j) = static_cast<T>(value);
+            }
+        },
+        Details::kGemmRowGrain);
+}
+
+// y = alpha * A * x + beta * y for the columns x and y.
+template <MatrixUtils::MatrixType F, MatrixUtils::MatrixType V,
+          Details::OutputMatrixType O,
+          Utils::FloatOrComplex T = Details::OutputElemType<O>>
+void Gemv(std::type_identity_t<T> alpha, const F &A, const V &x,
+          std::type_identity_t<T> beta, O &&y) {
+    using W = Utils::WideType<T>;
+
+    assert(x.Columns() == 1 && y.Columns() == 1 && "Gemv for columns.");
+    assert(A.Columns() == x.Rows() && A.Rows() == y.Rows() &&
+           "Matrix multiplication mismatch.");
+
+    Utils::ParallelFor(
+        0, y.Rows(),
+        [&](std::ptrdiff_t i) {
+            W sum = 0;
+            for (IndexType k = 0; k < A.Columns(); ++k) {
+                sum += static_cast<W>(A(i, k)) * static_cast<W>(x(k, 0));
+            }
+
+            auto value = static_cast<W>(alpha) * sum;
+            if (beta != T{0}) {
+                value += static_cast<W>(beta) * static_cast<W>(y(i, 0));
+            }
+            y(i, 0) = static_cast<T>(value);
+        },
+        Details::kGemmRowGrain * Details::kGemmRowGrain);
+}
+
+// A += alpha * x * y^H for the columns x and y.
+template <MatrixUtils::MatrixType U, MatrixUtils::MatrixType V,
+          Details::OutputMatrixType O,
+          Utils::FloatOrComplex T = Details::OutputElemType<O>>
+void Ger(std::type_identity_t<T> alpha, const U &x, const V &y, O &&A) {
+    assert(x.Columns() == 1 && y.Columns() == 1 && "Ger for columns.");
+    assert(A.Rows() == x.Rows() && A.Columns() == y.Rows() &&
+           "Wrong output size.");
+
+    Utils::ParallelFor(
+        0, A.Rows(),
+        [&](std::ptrdiff_t i) {
+            auto coeff = alpha * x(i, 0);
+            if (coeff == T{0}) {
+                return;
+            }
+            for (IndexType j = 0; j < A.Columns(); ++j) {
+                A(i, j) += coeff * Utils::Conj(y(j, 0));
+            }
+        },
+        Details::kGemmRowGrain);
+}
+
+// y += alpha * x for matrices of the same size.
+template <MatrixUtils::MatrixType V, Details::OutputMatrixType O,
+          Utils::FloatOrComplex T = Details::OutputElemType<O>>
+void Axpy(std::type_identity_t<T> alpha, const V &x, O &&y) {
+    assert(x.Rows() == y.Rows() && x.Columns() == y.Columns() &&
+           "Wrong output size.");
+
+    for (IndexType i = 0; i < y.Rows(); ++i) {
+        for (IndexType j = 0; j < y.Columns(); ++j) {
+            y(i, j) += alpha * x(i, j);
+        }
+    }
+}
+} // namespace LinearKit::Algorithm
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "../matrix_utils/cast_matrix.h"
+#include "../matrix_utils/checks.h"
+#include "../utils/sign.h"
+#include "../utils/thread_pool.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace LinearKit::Algorithm {
+using IndexType = LinearKit::Details::Types::IndexType;
+
+namespace Details {
+inline constexpr IndexType kCholeskyBlockSize = 64;
+inline constexpr IndexType kCholeskyTileSize = 64;
+
+// A = L * L^H with L in the lower triangle of the matrix. failed_pivot is the
+// first pivot that is not positive, or -1.
+template <Utils::FloatOrComplex T = long double>
+struct FactorCholesky {
+    Matrix<T> L;
+    IndexType failed_pivot = -1;
+
+    [[nodiscard]] bool IsPositiveDefinite() const {
+        return failed_pivot == -1;
+    }
+
+    Matrix<T> GetL() const {
+        Matrix<T> result(L.Rows(), L.Columns());
+        for (IndexType i = 0; i < L.Rows(); ++i) {
+            for (IndexType j = 0; j <= i; ++j) {
+                result(i, j) = L(i, j);
+            }
+        }
+
+        return result;
+    }
+};
+
+// Dot product of the rows first and second over the columns [from, to),
+// conjugating the second one.
+template <MatrixUtils::MatrixType M>
+typename M::ElemType RowProduct(const M &A, IndexType first, IndexType second,
+                                IndexType from, IndexType to) {
+    using T = typename M::ElemType;
+
+    T sum = 0;
+    for (IndexType k = from; k < to; ++k) {
+        sum += A(first, k) * Utils::Conj(A(second, k));
+    }
+
+    return sum;
+}
+
+// Unblocked factorization of the diagonal block [from, to).
+template <MatrixUtils::MutableMatrixType M>
+IndexType FactorDiagonalBlock(M &A, IndexType from, IndexType to) {
+    for (IndexType j = from; j < to; ++j) {
+        auto pivot = std::real(A(j, j) - RowProduct(A, j, j, from, j));
+        if (!(pivot > 0)) {
+            return j;
+        }
+
+        A(j, j) = std::sqrt(pivot);
+        for (IndexType i = j + 1; i < to; ++i) {
+            A(i, j) = (A(i, j) - RowProduct(A, i, j, from, j)) / A(j, j);
+        }
+    }
+
+    return -1;
+}
+} // namespace Details
+
+// Right-looking blocked Cholesky factorization of a Hermitian positive
+// definite matrix. Only the lower triangle is read and overwritten by L.
+// Returns the first pivot that is not positive, or -1 on success.
+template <MatrixUtils::MutableMatrixType M>
+IndexType CholeskyInPlace(M &matrix,
+                          IndexType block = Details::kCholeskyBlockSize) {
+    assert(MatrixUtils::IsSquare(matrix) &&
+           "Cholesky factorization for square matrices.");
+    assert(block > 0 && "Block size must be positive.");
+
+    constexpr auto kTile = Details::kCholeskyTileSize;
+    auto size = matrix.Rows();
+
+    for (IndexType from = 0; from < size; from += block) {
+        auto next = std::min(size, from + block);
+
+        auto failed = Details::FactorDiagonalBlock(matrix, from, next);
+        if (failed != -1) {
+            return failed;
+        }
+
+        // A21 = A21 * L11^-H.
+        auto row_tiles = (size - next + kTile - 1) / kTile;
+        Utils::ParallelFor(0, row_tiles, [&](std::ptrdiff_t tile) {
+            auto i_from = next + tile * kTile;
+            auto i_to = std::min(size, i_from + kTile);
+
+            for (IndexType i = i_from; i < i_to; ++i) {
+                for (IndexType j = from; j < next; ++j) {
+                    auto sum = Details::RowProduct(matrix, i, j, from, j);
+                    matrix(i, j) = (matrix(i, j) - sum) / matrix(j, j);
+                }
+            }
+        });
+
+        // A22 -= A21 * A21^H on the lower triangle, tile by tile.
+        std::vector<std::pair<IndexType, IndexType>> tiles;
+        for (IndexType ti = 0; ti < row_tiles; ++ti) {
+            for (IndexType tj = 0; tj <= ti; ++tj) {
+                tiles.emplace_back(ti, tj);
+            }
+        }
+
+        Utils::ParallelFor(0, tiles.size(), [&](std::ptrdiff_t idx) {
+            auto [ti, tj] = tiles[idx];
+            auto i_from = next + ti * kTile;
+            auto j_from = next + tj * kTile;
+            auto i_to = std::min(size, i_from + kTile);
+
+            for (IndexType i = i_from; i < i_to; ++i) {
+                auto j_to = std::min({size, j_from + kTile, i + 1});
+                for (IndexType j = j_from; j < j_to; ++j) {
+                    matrix(i, j) -=
+                        Details::RowProduct(matrix, i, j, from, next);
+                }
+            }
+        });
+    }
+
+    return -1;
+}
+
+template <Utils::FloatOrComplex T>
+Details::FactorCholesky<T>
+Cholesky(Matrix<T> &&matrix, IndexType block = Details::kCholeskyBlockSize) {
+    static_assert(Utils::StandardFloatOrComplex<T>,
+                  "Cholesky factorization for the standard floating types.");
+    Details::FactorCholesky<T> factor{std::move(matrix)};
+    factor.failed_pivot = CholeskyInPlace(factor.L, block);
+    return factor;
+}
+
+template <MatrixUtils::MatrixType M>
+Details::FactorCholesky<Utils::WideType<typename M::ElemType>>
+Cholesky(const M &matrix, IndexType block = Details::kCholeskyBlockSize) {
+    return Cholesky(MatrixUtils::WidenMatrix(matrix), block);
+}
+} // namespace LinearKit::Algorithm
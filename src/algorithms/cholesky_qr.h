@@ -0,0 +1,195 @@
+#pragma once
+
+#include "cholesky.h"
+#include "qr_decomposition.h"
+
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace LinearKit::Algorithm {
+namespace Details {
+inline constexpr IndexType kCholeskyQRTileSize = 256;
+
+// The lower triangle of A^H * A. Row tiles accumulate their own Gram
+// matrices on the thread pool, which are summed afterwards.
+template <MatrixUtils::MatrixType M>
+Matrix<typename M::ElemType> GetGramMatrix(const M &A) {
+    using T = typename M::ElemType;
+
+    auto rows = A.Rows();
+    auto cols = A.Columns();
+    auto chunks = std::min<IndexType>(
+        Utils::ThreadPool::Instance().Concurrency(),
+        (rows + kCholeskyQRTileSize - 1) / kCholeskyQRTileSize);
+    chunks = std::max(chunks, IndexType{1});
+
+    std::vector<Matrix<T>> partial(chunks, Matrix<T>(cols, cols));
+    Utils::ParallelFor(0, chunks, [&](std::ptrdiff_t c) {
+        auto &G = partial[c];
+        for (IndexType r = c * rows / chunks; r < (c + 1) * rows / chunks;
+             ++r) {
+            for (IndexType i = 0; i < cols; ++i) {
+                auto coeff = Utils::Conj(A(r, i));
+                for (IndexType j = 0; j <= i; ++j) {
+                    G(i, j) += coeff * A(r, j);
+                }
+            }
+        }
+    });
+
+    for (IndexType c = 1; c < chunks; ++c) {
+        for (IndexType i = 0; i < cols; ++i) {
+            for (IndexType j = 0; j <= i; ++j) {
+                partial[0](i, j) += partial[c](i, j);
+            }
+        }
+    }
+
+    return std::move(partial[0]);
+}
+
+// A = A * L^-H row by row, where L is the lower triangle of the factor.
+template <MatrixUtils::MutableMatrixType M>
+void SolveRowsByCholesky(M &A, const Matrix<typename M::ElemType> &L) {
+    auto rows = A.Rows();
+    auto cols = A.Columns();
+    auto row_tiles = (rows + kCholeskyQRTileSize - 1) / kCholeskyQRTileSize;
+
+    Utils::ParallelFor(0, row_tiles, [&](std::ptrdiff_t tile) {
+        auto r_from = tile * kCholeskyQRTileSize;
+        auto r_to = std::min(rows, r_from + kCholeskyQRTileSize);
+
+        for (IndexType r = r_from; r < r_to; ++r) {
+            for (IndexType j = 0; j < cols; ++j) {
+                auto sum = A(r, j);
+                for (IndexType k = 0; k < j; ++k) {
+                    sum -= A(r, k) * Utils::Conj(L(j, k));
+                }
+                A(r, j) = sum / L(j, j);
+            }
+        }
+    });
+}
+
+// One pass of CholeskyQR: A = Q * L^H in place with the Gram matrix shifted
+// by shift * I. Returns L, or nothing if the Gram matrix is not numerically
+// positive definite.
+template <MatrixUtils::MutableMatrixType M>
+std::optional<Matrix<typename M::ElemType>>
+CholeskyQRPass(M &A, Utils::RealType<typename M::ElemType> shift) {
+    auto G = GetGramMatrix(A);
+    for (IndexType i = 0; i < G.Rows(); ++i) {
+        G(i, i) += shift;
+    }
+
+    if (CholeskyInPlace(G) != -1) {
+        return std::nullopt;
+    }
+
+    SolveRowsByCholesky(A, G);
+    return G;
+}
+
+// R = U * R for upper triangular R and U, U(i, j) = upper(i, j) for j >= i.
+template <Utils::FloatOrComplex T, typename Upper>
+void MultiplyByUpper(Matrix<T> &R, Upper upper) {
+    auto size = R.Rows();
+    for (IndexType i = 0; i < size; ++i) {
+        for (IndexType j = i; j < size; ++j) {
+            T sum = 0;
+            for (IndexType k = i; k <= j; ++k) {
+                sum += upper(i, k) * R(k, j);
+            }
+            R(i, j) = sum;
+        }
+    }
+}
+
+// The shift of Fukaya et al. that keeps the Gram matrix positive definite up
+// to cond(A) ~ 1 / eps.
+template <MatrixUtils::MatrixType M>
+Utils::RealType<typename M::ElemType> GetCholeskyQRShift(const M &A) {
+    using Real = Utils::RealType<typename M::ElemType>;
+
+    Real norm = 0;
+    for (IndexType i = 0; i < A.Rows(); ++i) {
+        for (IndexType j = 0; j < A.Columns(); ++j) {
+            norm += std::norm(A(i, j));
+        }
+    }
+
+    auto size = static_cast<Real>(A.Rows() * A.Columns() +
+                                  A.Columns() * (A.Columns() + 1));
+    return 11 * size * (std::numeric_limits<Real>::epsilon() / 2) * norm;
+}
+} // namespace Details
+
+// Orthonormalizes the columns of a tall block in place and returns R with
+// A = Q * R. CholeskyQR2 is used first: the Gram matrix, its Cholesky factor
+// and a triangular solve, twice. If a Gram matrix is not numerically positive
+// definite, the shifted CholeskyQR3 continues from the current block, and
+// Householder QR is the last resort. Each step keeps A = block * R, so the
+// steps that succeeded are not repeated.
+template <MatrixUtils::MutableMatrixType M>
+Matrix<typename M::ElemType> OrthonormalizeColumns(M &block) {
+    using T = typename M::ElemType;
+    using Real = Utils::RealType<T>;
+
+    auto rows = block.Rows();
+    auto cols = block.Columns();
+
+    assert(rows >= cols && "Orthonormalization for rows >= columns.");
+
+    Matrix<T> R = Matrix<T>::Identity(cols);
+    auto run_pass = [&](Real shift) {
+        auto L = Details::CholeskyQRPass(block, shift);
+        if (!L) {
+            return false;
+        }
+
+        Details::MultiplyByUpper(R, [&](IndexType i, IndexType k) {
+            return Utils::Conj((*L)(k, i));
+        });
+        return true;
+    };
+
+    if (run_pass(0) && run_pass(0)) {
+        return R;
+    }
+
+    if (run_pass(Details::GetCholeskyQRShift(block)) && run_pass(0) &&
+        run_pass(0)) {
+        return R;
+    }
+
+    auto factor = CompactQR(block);
+    Matrix<T> Q(rows, cols);
+    for (IndexType i = 0; i < cols; ++i) {
+        Q(i, i) = T{1};
+    }
+    factor.ApplyQ(Q, false);
+
+    for (IndexType i = 0; i < rows; ++i) {
+        for (IndexType j = 0; j < cols; ++j) {
+            block(i, j) = Q(i, j);
+        }
+    }
+
+    Details::MultiplyByUpper(
+        R, [&](IndexType i, IndexType k) { return factor.QR(i, k); });
+    return R;
+}
+
+// Thin QR of a tall matrix by OrthonormalizeColumns.
+template <MatrixUtils::MatrixType M>
+Details::PairQR<typename M::ElemType> CholeskyQR2(const M &matrix) {
+    using T = typename M::ElemType;
+
+    static_assert(Utils::StandardFloatOrComplex<T>,
+                  "CholeskyQR2 for the standard floating types.");
+    Matrix<T> Q = matrix;
+    auto R = OrthonormalizeColumns(Q);
+    return {std::move(Q), std::move(R)};
+}
+} // namespace LinearKit::Algorithm
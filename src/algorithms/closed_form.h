@@ -0,0 +1,347 @@
+#pragma once
+
+#include "fixed_kernels.h"
+
+#include <numbers>
+
+namespace LinearKit::Algorithm {
+namespace Details {
+// [[cos, sin], [-sin, cos]] * [[a, b], [b, c]] * [[cos, -sin], [sin, cos]] =
+// diag(first, second) with |first| >= |second|.
+template <Utils::Details::FloatingPoint T>
+struct SymmetricEigen2x2 {
+    T first = 0;
+    T second = 0;
+    T cos = 1;
+    T sin = 0;
+};
+
+// [[csl, snl], [-snl, csl]] * [[f, g], [0, h]] * [[csr, -snr], [snr, csr]] =
+// diag(max, min) with |max| >= |min|; the singular values are signed.
+template <Utils::Details::FloatingPoint T>
+struct TriangularSVD2x2 {
+    T max = 0;
+    T min = 0;
+    T csl = 1;
+    T snl = 0;
+    T csr = 1;
+    T snr = 0;
+};
+
+// |magnitude| with the sign of sign, as Fortran SIGN.
+template <Utils::Details::FloatingPoint T>
+T CopySign(T magnitude, T sign) {
+    return (sign >= 0) ? Utils::Abs(magnitude) : -Utils::Abs(magnitude);
+}
+} // namespace Details
+
+// The eigenvalues and the eigenvector of the first one of [[a, b], [b, c]]
+// without cancellation, as LAPACK laev2.
+template <Utils::Details::FloatingPoint T>
+Details::SymmetricEigen2x2<T> GetSymmetricEigen2x2(T a, T b, T c) {
+    auto sum = a + c;
+    auto diff = a - c;
+    auto abs_diff = Utils::Abs(diff);
+    auto twice_b = b + b;
+    auto abs_b = Utils::Abs(twice_b);
+
+    auto [max_ac, min_ac] =
+        (Utils::Abs(a) > Utils::Abs(c)) ? std::pair{a, c} : std::pair{c, a};
+
+    T root;
+    if (abs_diff > abs_b) {
+        auto ratio = abs_b / abs_diff;
+        root = abs_diff * Utils::Sqrt(1 + ratio * ratio);
+    } else if (abs_diff < abs_b) {
+        auto ratio = abs_diff / abs_b;
+        root = abs_b * Utils::Sqrt(1 + ratio * ratio);
+    } else {
+        root = abs_b * Utils::Sqrt(T{2});
+    }
+
+    Details::SymmetricEigen2x2<T> result;
+    T sign_first = 1;
+    if (sum != 0) {
+        sign_first = (sum < 0) ? T{-1} : T{1};
+        result.first = (sum + sign_first * root) / 2;
+        // The second one from the determinant, since the sum cancels.
+        result.second =
+            (max_ac / result.first) * min_ac - (b / result.first) * b;
+    } else {
+        result.first = root / 2;
+        result.second = -root / 2;
+    }
+
+    T sign_second = (diff >= 0) ? T{1} : T{-1};
+    auto cs = diff + sign_second * root;
+    if (Utils::Abs(cs) > abs_b) {
+        auto ct = -twice_b / cs;
+        result.sin = 1 / Utils::Sqrt(1 + ct * ct);
+        result.cos = ct * result.sin;
+    } else if (abs_b != 0) {
+        auto tn = -cs / twice_b;
+        result.cos = 1 / Utils::Sqrt(1 + tn * tn);
+        result.sin = tn * result.cos;
+    }
+
+    if (sign_first == sign_second) {
+        auto tn = result.cos;
+        result.cos = -result.sin;
+        result.sin = tn;
+    }
+
+    return result;
+}
+
+// The SVD of the upper triangular [[f, g], [0, h]], as LAPACK lasv2.
+template <Utils::Details::FloatingPoint T>
+Details::TriangularSVD2x2<T> GetTriangularSVD2x2(T f, T g, T h) {
+    using Details::CopySign;
+
+    auto ft = f;
+    auto fa = Utils::Abs(ft);
+    auto ht = h;
+    auto ha = Utils::Abs(h);
+
+    // The index of the largest of |f|, |g|, |h|.
+    int pmax = 1;
+    bool swap = ha > fa;
+    if (swap) {
+        pmax = 3;
+        std::swap(ft, ht);
+        std::swap(fa, ha);
+    }
+
+    auto gt = g;
+    auto ga = Utils::Abs(gt);
+
+    T clt = 1;
+    T crt = 1;
+    T slt = 0;
+    T srt = 0;
+    Details::TriangularSVD2x2<T> result;
+
+    if (ga == 0) {
+        result.min = ha;
+        result.max = fa;
+    } else {
+        bool is_small_g = true;
+        if (ga > fa) {
+            pmax = 2;
+            if (fa / ga < std::numeric_limits<T>::epsilon()) {
+                is_small_g = false;
+                result.max = ga;
+                result.min = (ha > 1) ? fa / (ga / ha) : (fa / ga) * ha;
+                slt = ht / gt;
+                srt = 1;
+                crt = ft / gt;
+            }
+        }
+
+        if (is_small_g) {
+            auto d = fa - ha;
+            auto l = (d == fa) ? T{1} : d / fa;
+            auto m = gt / ft;
+            auto t = 2 - l;
+            auto mm = m * m;
+            auto s = Utils::Sqrt(t * t + mm);
+            auto r = (l == 0) ? Utils::Abs(m) : Utils::Sqrt(l * l + mm);
+            auto a = (s + r) / 2;
+
+            result.min = ha / a;
+            result.max = fa * a;
+
+            if (mm == 0) {
+                t = (l == 0) ? CopySign(T{2}, ft) * CopySign(T{1}, gt)
+                             : gt / CopySign(d, ft) + m / t;
+            } else {
+                t = (m / (s + t) + m / (r + l)) * (1 + a);
+            }
+
+            l = Utils::Sqrt(t * t + 4);
+            crt = 2 / l;
+            srt = t / l;
+            clt = (crt + srt * m) / a;
+            slt = (ht / ft) * srt / a;
+        }
+    }
+
+    if (swap) {
+        result.csl = srt;
+        result.snl = crt;
+        result.csr = slt;
+        result.snr = clt;
+    } else {
+        result.csl = clt;
+        result.snl = slt;
+        result.csr = crt;
+        result.snr = srt;
+    }
+
+    T sign = 1;
+    if (pmax == 1) {
+        sign = CopySign(T{1}, result.csr) * CopySign(T{1}, result.csl) *
+               CopySign(T{1}, f);
+    } else if (pmax == 2) {
+        sign = CopySign(T{1}, result.snr) * CopySign(T{1}, result.csl) *
+               CopySign(T{1}, g);
+    } else {
+        sign = CopySign(T{1}, result.snr) * CopySign(T{1}, result.snl) *
+               CopySign(T{1}, h);
+    }
+
+    result.max = CopySign(result.max, sign);
+    result.min =
+        CopySign(result.min, sign * CopySign(T{1}, f) * CopySign(T{1}, h));
+    return result;
+}
+
+// The spectral decomposition of a real symmetric 3 x 3 matrix with the
+// eigenvalues in descending order. The eigenvalue farthest from the others
+// comes from the trigonometric formula and its eigenvector from the cross
+// products of the rows of A - lambda * I; the other two come from the 2 x 2
+// problem in the orthogonal complement, which keeps repeated eigenvalues
+// accurate.
+template <MatrixUtils::MatrixType M>
+    requires Utils::Details::FloatingPoint<typename M::ElemType>
+Details::FixedSpectralPair<typename M::ElemType, 3>
+GetSymmetricEigen3x3(const M &matrix) {
+    using T = typename M::ElemType;
+    using Vector = std::array<T, 3>;
+
+    assert(matrix.Rows() == 3 && matrix.Columns() == 3 &&
+           "Closed form for 3 x 3 matrices.");
+    assert(MatrixUtils::IsSymmetric(matrix) &&
+           "Spectral decomposition for symmetric matrices.");
+
+    auto dot = [](const Vector &lhs, const Vector &rhs) {
+        return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2];
+    };
+    auto cross = [](const Vector &lhs, const Vector &rhs) {
+        return Vector{lhs[1] * rhs[2] - lhs[2] * rhs[1],
+                      lhs[2] * rhs[0] - lhs[0] * rhs[2],
+                      lhs[0] * rhs[1] - lhs[1] * rhs[0]};
+    };
+
+    // Scaled to avoid overflow in the cubic terms.
+    T scale = 0;
+    for (IndexType i = 0; i < 3; ++i) {
+        for (IndexType j = 0; j < 3; ++j) {
+            scale = std::max(scale, std::abs(matrix(i, j)));
+        }
+    }
+    if (scale == 0) {
+        return {Matrix<T, 3, 3>{}, Matrix<T, 3, 3>::Identity()};
+    }
+
+    Matrix<T, 3, 3> A;
+    for (IndexType i = 0; i < 3; ++i) {
+        for (IndexType j = 0; j < 3; ++j) {
+            A(i, j) = matrix(i, j) / scale;
+        }
+    }
+
+    auto apply = [&](const Vector &vec) {
+        Vector result{};
+        for (IndexType i = 0; i < 3; ++i) {
+            for (IndexType j = 0; j < 3; ++j) {
+                result[i] += A(i, j) * vec[j];
+            }
+        }
+        return result;
+    };
+
+    auto mean = (A(0, 0) + A(1, 1) + A(2, 2)) / 3;
+    auto off = A(0, 1) * A(0, 1) + A(0, 2) * A(0, 2) + A(1, 2) * A(1, 2);
+    auto diag = (A(0, 0) - mean) * (A(0, 0) - mean) +
+                (A(1, 1) - mean) * (A(1, 1) - mean) +
+                (A(2, 2) - mean) * (A(2, 2) - mean);
+    auto p = std::sqrt((diag + 2 * off) / 6);
+
+    // The eigenvalues of the scaled matrix.
+    T max_eigen = mean;
+    T min_eigen = mean;
+    T mid_eigen = mean;
+    if (p > 0) {
+        Matrix<T, 3, 3> B = A;
+        for (IndexType i = 0; i < 3; ++i) {
+            B(i, i) -= mean;
+        }
+        B /= p;
+        auto det = B(0, 0) * (B(1, 1) * B(2, 2) - B(1, 2) * B(2, 1)) -
+                   B(0, 1) * (B(1, 0) * B(2, 2) - B(1, 2) * B(2, 0)) +
+                   B(0, 2) * (B(1, 0) * B(2, 1) - B(1, 1) * B(2, 0));
+        auto phi = std::acos(std::clamp(det / 2, T{-1}, T{1})) / 3;
+
+        max_eigen = mean + 2 * p * std::cos(phi);
+        min_eigen =
+            mean + 2 * p * std::cos(phi + 2 * std::numbers::pi_v<T> / 3);
+        mid_eigen = 3 * mean - max_eigen - min_eigen;
+    }
+
+    auto lambda = (max_eigen - mid_eigen >= mid_eigen - min_eigen) ? max_eigen
+                                                                   : min_eigen;
+
+    // The longest cross product of the rows of A - lambda * I.
+    Vector rows[3];
+    for (IndexType i = 0; i < 3; ++i) {
+        for (IndexType j = 0; j < 3; ++j) {
+            rows[i][j] = A(i, j) - ((i == j) ? lambda : T{0});
+        }
+    }
+
+    Vector first = {1, 0, 0};
+    T best = 0;
+    for (auto [i, j] : {std::pair{0, 1}, {0, 2}, {1, 2}}) {
+        auto candidate = cross(rows[i], rows[j]);
+        auto norm = dot(candidate, candidate);
+        if (norm > best) {
+            best = norm;
+            first = candidate;
+        }
+    }
+    auto first_norm = std::sqrt(dot(first, first));
+    for (auto &value : first) {
+        value /= first_norm;
+    }
+
+    // An orthonormal basis of the complement.
+    auto axis = (std::abs(first[0]) > std::abs(first[1])) ? Vector{0, 1, 0}
+                                                          : Vector{1, 0, 0};
+    auto second = cross(first, axis);
+    auto second_norm = std::sqrt(dot(second, second));
+    for (auto &value : second) {
+        value /= second_norm;
+    }
+    auto third = cross(first, second);
+
+    auto A_second = apply(second);
+    auto A_third = apply(third);
+    auto pair = GetSymmetricEigen2x2(dot(second, A_second),
+                                     dot(second, A_third),
+                                     dot(third, A_third));
+
+    Vector vectors[3] = {first, {}, {}};
+    T values[3] = {dot(first, apply(first)), pair.first, pair.second};
+    for (IndexType i = 0; i < 3; ++i) {
+        vectors[1][i] = pair.cos * second[i] + pair.sin * third[i];
+        vectors[2][i] = -pair.sin * second[i] + pair.cos * third[i];
+    }
+
+    IndexType order[3] = {0, 1, 2};
+    std::sort(order, order + 3,
+              [&](IndexType lhs, IndexType rhs) {
+                  return values[lhs] > values[rhs];
+              });
+
+    Details::FixedSpectralPair<T, 3> result;
+    for (IndexType j = 0; j < 3; ++j) {
+        result.D(j, j) = values[order[j]] * scale;
+        for (IndexType i = 0; i < 3; ++i) {
+            result.U(i, j) = vectors[order[j]][i];
+        }
+    }
+
+    return result;
+}
+} // namespace LinearKit::Algorithm
@@ -0,0 +1,331 @@
+#pragma once
+
+#include "qr_algorithm.h"
+#include "solve.h"
+#include "svd.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace LinearKit::Algorithm {
+namespace Details {
+// X = V * diag(scale) * W^H * B, where V and W are given by their first
+// scale.size() columns, and B = rhs. Columns with zero scale are skipped.
+template <Utils::FloatOrComplex T, MatrixUtils::MatrixType M>
+Matrix<T> ApplySpectralScaling(const Matrix<T> &V, const Matrix<T> &W,
+                               const std::vector<Utils::RealType<T>> &scale,
+                               const M &rhs) {
+    assert(rhs.Rows() == W.Rows() && "Wrong number of rows.");
+
+    IndexType count = scale.size();
+    Matrix<T> coeffs(count, rhs.Columns());
+
+    for (IndexType i = 0; i < count; ++i) {
+        if (scale[i] == 0) {
+            continue;
+        }
+        for (IndexType r = 0; r < W.Rows(); ++r) {
+            auto w = Utils::Conj(W(r, i)) * scale[i];
+            for (IndexType j = 0; j < rhs.Columns(); ++j) {
+                coeffs(i, j) += w * rhs(r, j);
+            }
+        }
+    }
+
+    Matrix<T> X(V.Rows(), rhs.Columns());
+    for (IndexType r = 0; r < V.Rows(); ++r) {
+        for (IndexType i = 0; i < count; ++i) {
+            auto v = V(r, i);
+            for (IndexType j = 0; j < rhs.Columns(); ++j) {
+                X(r, j) += v * coeffs(i, j);
+            }
+        }
+    }
+
+    return X;
+}
+
+// Inverted values above the tolerance and zeros for the rest.
+template <Utils::FloatOrComplex R>
+std::vector<R> InvertAbove(const std::vector<R> &values, R tol) {
+    std::vector<R> result(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (Utils::Abs(values[i]) > tol) {
+            result[i] = R{1} / values[i];
+        }
+    }
+
+    return result;
+}
+
+template <Utils::FloatOrComplex R>
+R GetDefaultTolerance(const std::vector<R> &values, IndexType size) {
+    R max = 0;
+    for (auto val : values) {
+        max = std::max(max, Utils::Abs(val));
+    }
+
+    return static_cast<R>(size) * std::numeric_limits<R>::epsilon() * max;
+}
+} // namespace Details
+
+// The factorizations below are computed once in the constructor. All the
+// queries are const and do not touch shared state, so one object may be used
+// from many threads at once.
+
+template <Utils::FloatOrComplex T>
+class QRFactorization {
+    using Real = Utils::RealType<T>;
+
+public:
+    template <MatrixUtils::MatrixType M>
+    explicit QRFactorization(const M &matrix) : factor_(CompactQR(matrix)) {
+    }
+
+    explicit QRFactorization(Matrix<T> &&matrix)
+        : factor_(CompactQR(std::move(matrix))) {
+    }
+
+    [[nodiscard]] IndexType Rows() const {
+        return factor_.QR.Rows();
+    }
+
+    [[nodiscard]] IndexType Columns() const {
+        return factor_.QR.Columns();
+    }
+
+    const Details::FactorQR<T> &GetFactor() const {
+        return factor_;
+    }
+
+    // The exact solution for a square matrix, the least squares one for a
+    // matrix with more rows.
+    template <MatrixUtils::MatrixType M>
+    Matrix<T> Solve(const M &rhs) const {
+        if (Rows() == Columns()) {
+            return Algorithm::Solve(factor_, rhs);
+        }
+        return LeastSquares(factor_, rhs);
+    }
+
+    // Without pivoting the diagonal of R only estimates the rank and the
+    // condition number: the ratio is a lower bound of the latter.
+    [[nodiscard]] IndexType Rank(Real tol = Real{-1}) const {
+        auto diag = GetDiagonal();
+        if (tol < 0) {
+            tol = Details::GetDefaultTolerance(diag,
+                                               std::max(Rows(), Columns()));
+        }
+
+        return std::count_if(diag.begin(), diag.end(),
+                             [&](Real val) { return val > tol; });
+    }
+
+    [[nodiscard]] Real ConditionNumber() const {
+        auto diag = GetDiagonal();
+        if (diag.empty()) {
+            return Real{1};
+        }
+
+        auto [min, max] = std::minmax_element(diag.begin(), diag.end());
+        if (*min == 0) {
+            return std::numeric_limits<Real>::infinity();
+        }
+        return *max / *min;
+    }
+
+private:
+    std::vector<Real> GetDiagonal() const {
+        std::vector<Real> diag(factor_.tau.size());
+        for (IndexType i = 0; i < static_cast<IndexType>(diag.size()); ++i) {
+            diag[i] = Utils::Abs(factor_.QR(i, i));
+        }
+        return diag;
+    }
+
+    Details::FactorQR<T> factor_;
+};
+
+// The 16-bit storage types are factorized in Utils::WideType, as CompactQR
+// and SVD do.
+template <MatrixUtils::MatrixType M>
+QRFactorization(const M &)
+    -> QRFactorization<Utils::WideType<typename M::ElemType>>;
+
+template <Utils::FloatOrComplex T>
+QRFactorization(Matrix<T> &&) -> QRFactorization<Utils::WideType<T>>;
+
+template <Utils::FloatOrComplex T>
+class SVDFactorization {
+    using Real = Utils::RealType<T>;
+
+public:
+    template <MatrixUtils::MatrixType M>
+    explicit SVDFactorization(const M &matrix,
+                              SVDEngine engine = SVDEngine::Auto)
+        : rows_(matrix.Rows()), cols_(matrix.Columns()) {
+        auto [U, S, VT] = SVD(matrix, engine);
+
+        for (IndexType i = 0; i < S.Rows(); ++i) {
+            for (IndexType j = 0; j < S.Columns(); ++j) {
+                sigma_.push_back(Utils::Real(S(i, j)));
+            }
+        }
+        U_ = std::move(U);
+        V_ = Matrix<T>(Matrix<T>::Conjugated(VT));
+    }
+
+    const Matrix<T> &GetU() const {
+        return U_;
+    }
+
+    const Matrix<T> &GetV() const {
+        return V_;
+    }
+
+    // In the descending order.
+    const std::vector<Real> &GetSingularValues() const {
+        return sigma_;
+    }
+
+    [[nodiscard]] Real DefaultTolerance() const {
+        return Details::GetDefaultTolerance(sigma_, std::max(rows_, cols_));
+    }
+
+    // A^+ * B, the singular values not above tol are treated as zeros.
+    template <MatrixUtils::MatrixType M>
+    Matrix<T> ApplyPseudoinverse(const M &rhs, Real tol = Real{-1}) const {
+        if (tol < 0) {
+            tol = DefaultTolerance();
+        }
+
+        return Details::ApplySpectralScaling(V_, U_,
+                                             Details::InvertAbove(sigma_, tol),
+                                             rhs);
+    }
+
+    template <MatrixUtils::MatrixType M>
+    Matrix<T> Solve(const M &rhs) const {
+        return ApplyPseudoinverse(rhs);
+    }
+
+    [[nodiscard]] IndexType Rank(Real tol = Real{-1}) const {
+        if (tol < 0) {
+            tol = DefaultTolerance();
+        }
+
+        return std::count_if(sigma_.begin(), sigma_.end(),
+                             [&](Real val) { return val > tol; });
+    }
+
+    [[nodiscard]] Real ConditionNumber() const {
+        if (sigma_.empty()) {
+            return Real{1};
+        }
+        if (sigma_.back() == 0) {
+            return std::numeric_limits<Real>::infinity();
+        }
+        return sigma_.front() / sigma_.back();
+    }
+
+private:
+    IndexType rows_;
+    IndexType cols_;
+    Matrix<T> U_;
+    Matrix<T> V_;
+    std::vector<Real> sigma_;
+};
+
+template <MatrixUtils::MatrixType M>
+SVDFactorization(const M &)
+    -> SVDFactorization<Utils::WideType<typename M::ElemType>>;
+
+template <MatrixUtils::MatrixType M>
+SVDFactorization(const M &, SVDEngine)
+    -> SVDFactorization<Utils::WideType<typename M::ElemType>>;
+
+// Eigendecomposition A = U * diag(lambda) * U^H of a Hermitian matrix.
+template <Utils::FloatOrComplex T>
+class EigenFactorization {
+    using Real = Utils::RealType<T>;
+
+public:
+    template <MatrixUtils::MatrixType M>
+    explicit EigenFactorization(const M &matrix) {
+        auto [D, U, is_converged] = GetCheckedSpecDecomposition(matrix);
+        is_converged_ = is_converged;
+
+        lambda_.resize(D.Rows());
+        for (IndexType i = 0; i < D.Rows(); ++i) {
+            lambda_[i] = Utils::Real(D(i, i));
+        }
+        U_ = std::move(U);
+    }
+
+    const Matrix<T> &GetEigenvectors() const {
+        return U_;
+    }
+
+    const std::vector<Real> &GetEigenvalues() const {
+        return lambda_;
+    }
+
+    // False if the QR iteration stopped at its limit.
+    [[nodiscard]] bool IsConverged() const {
+        return is_converged_;
+    }
+
+    [[nodiscard]] Real DefaultTolerance() const {
+        return Details::GetDefaultTolerance(lambda_, U_.Rows());
+    }
+
+    template <MatrixUtils::MatrixType M>
+    Matrix<T> ApplyPseudoinverse(const M &rhs, Real tol = Real{-1}) const {
+        if (tol < 0) {
+            tol = DefaultTolerance();
+        }
+
+        return Details::ApplySpectralScaling(
+            U_, U_, Details::InvertAbove(lambda_, tol), rhs);
+    }
+
+    template <MatrixUtils::MatrixType M>
+    Matrix<T> Solve(const M &rhs) const {
+        return ApplyPseudoinverse(rhs);
+    }
+
+    [[nodiscard]] IndexType Rank(Real tol = Real{-1}) const {
+        if (tol < 0) {
+            tol = DefaultTolerance();
+        }
+
+        return std::count_if(lambda_.begin(), lambda_.end(),
+                             [&](Real val) { return Utils::Abs(val) > tol; });
+    }
+
+    [[nodiscard]] Real ConditionNumber() const {
+        if (lambda_.empty()) {
+            return Real{1};
+        }
+
+        auto [min, max] = std::minmax_element(
+            lambda_.begin(), lambda_.end(),
+            [](Real lhs, Real rhs) {
+                return Utils::Abs(lhs) < Utils::Abs(rhs);
+            });
+        if (*min == 0) {
+            return std::numeric_limits<Real>::infinity();
+        }
+        return Utils::Abs(*max) / Utils::Abs(*min);
+    }
+
+private:
+    Matrix<T> U_;
+    std::vector<Real> lambda_;
+    bool is_converged_ = true;
+};
+
+template <MatrixUtils::MatrixType M>
+EigenFactorization(const M &) -> EigenFactorization<typename M::ElemType>;
+} // namespace LinearKit::Algorithm
@@ -0,0 +1,274 @@
+#pragma once
+
+#include "../matrix_utils/checks.h"
+#include "../utils/sign.h"
+
+#include <limits>
+
+namespace LinearKit::Algorithm {
+using IndexType = LinearKit::Details::Types::IndexType;
+
+namespace Details {
+inline constexpr IndexType kFixedJacobiMaxSweeps = 30;
+
+template <Utils::FloatOrComplex T, IndexType Rows, IndexType Cols>
+struct FixedPairQR {
+    Matrix<T, Rows, Rows> Q;
+    Matrix<T, Rows, Cols> R;
+};
+
+template <Utils::FloatOrComplex T, IndexType Size>
+struct FixedSpectralPair {
+    Matrix<T, Size, Size> D;
+    Matrix<T, Size, Size> U;
+};
+
+template <Utils::FloatOrComplex T, IndexType Rows, IndexType Cols>
+struct FixedSingularBasis {
+    Matrix<T, Rows, Rows> U;
+    Matrix<T, 1, std::min(Rows, Cols)> S;
+    Matrix<T, Cols, Cols> VT;
+};
+
+// The rotation W = diag(1, conj(e)) * [[c, s], [-s, c]] that diagonalizes
+// W^H * [[a, g], [conj(g), d]] * W, with c = 1 and s = 0 for g = 0. There
+// are no branches on the data, so it also runs over SIMD lanes.
+template <Utils::FloatOrComplex T>
+void GetHermitianJacobiRotation(Utils::RealType<T> a, Utils::RealType<T> d,
+                                T g, Utils::RealType<T> &c,
+                                Utils::RealType<T> &s, T &e) {
+    using Real = Utils::RealType<T>;
+
+    auto abs_g = std::abs(g);
+    auto safe = (abs_g > 0) ? abs_g : Real{1};
+    auto zeta = (d - a) / (2 * safe);
+    auto t = ((zeta >= 0) ? Real{1} : Real{-1}) /
+             (std::abs(zeta) + std::sqrt(1 + zeta * zeta));
+    t = (abs_g > 0) ? t : Real{0};
+
+    c = 1 / std::sqrt(1 + t * t);
+    s = c * t;
+    e = (abs_g > 0) ? g / safe : T{1};
+}
+
+// Columns p and q of A become (p, q) * W for W of GetHermitianJacobiRotation.
+template <Utils::FloatOrComplex T, IndexType Rows, IndexType Cols>
+void RotateFixedColumns(Matrix<T, Rows, Cols> &A, IndexType p, IndexType q,
+                        Utils::RealType<T> c, Utils::RealType<T> s, T e) {
+    for (IndexType i = 0; i < Rows; ++i) {
+        auto lhs = A(i, p);
+        auto rhs = Utils::Conj(e) * A(i, q);
+        A(i, p) = c * lhs - s * rhs;
+        A(i, q) = s * lhs + c * rhs;
+    }
+}
+
+// Householder QR with the loops over the compile-time sizes.
+template <Utils::FloatOrComplex T, IndexType Rows, IndexType Cols>
+FixedPairQR<T, Rows, Cols> FixedHouseholderQR(const Matrix<T, Rows, Cols> &A) {
+    using Real = Utils::RealType<T>;
+
+    auto Q = Matrix<T, Rows, Rows>::Identity();
+    auto R = A;
+
+    for (IndexType k = 0; k < std::min(Rows - 1, Cols); ++k) {
+        Real norm = 0;
+        for (IndexType i = k; i < Rows; ++i) {
+            norm += std::norm(R(i, k));
+        }
+
+        auto head = R(k, k);
+        auto abs_head = std::abs(head);
+        auto alpha = -((abs_head > 0) ? head / abs_head : T{1}) *
+                     std::sqrt(norm);
+        auto v_head = head - alpha;
+        auto v_norm = norm - abs_head * abs_head + std::norm(v_head);
+        if (!(v_norm > 0)) {
+            continue;
+        }
+        auto beta = Real{2} / v_norm;
+
+        T v[Rows > 0 ? Rows : 1];
+        v[k] = v_head;
+        for (IndexType i = k + 1; i < Rows; ++i) {
+            v[i] = R(i, k);
+        }
+
+        for (IndexType j = k; j < Cols; ++j) {
+            T w = 0;
+            for (IndexType i = k; i < Rows; ++i) {
+                w += Utils::Conj(v[i]) * R(i, j);
+            }
+            w *= beta;
+            for (IndexType i = k; i < Rows; ++i) {
+                R(i, j) -= v[i] * w;
+            }
+        }
+        for (IndexType i = k + 1; i < Rows; ++i) {
+            R(i, k) = T{0};
+        }
+
+        for (IndexType r = 0; r < Rows; ++r) {
+            T w = 0;
+            for (IndexType i = k; i < Rows; ++i) {
+                w += Q(r, i) * v[i];
+            }
+            w *= beta;
+            for (IndexType i = k; i < Rows; ++i) {
+                Q(r, i) -= w * Utils::Conj(v[i]);
+            }
+        }
+    }
+
+    return {Q, R};
+}
+
+// Cyclic Jacobi method for a Hermitian matrix.
+template <Utils::FloatOrComplex T, IndexType Size>
+FixedSpectralPair<T, Size>
+FixedJacobiEigen(const Matrix<T, Size, Size> &A,
+                 IndexType max_sweeps = kFixedJacobiMaxSweeps) {
+    using Real = Utils::RealType<T>;
+
+    auto D = A;
+    auto U = Matrix<T, Size, Size>::Identity();
+    auto tol = std::numeric_limits<Real>::epsilon() * Real{Size};
+
+    for (IndexType sweep = 0; sweep < max_sweeps; ++sweep) {
+        Real off = 0;
+        Real total = 0;
+        for (IndexType i = 0; i < Size; ++i) {
+            for (IndexType j = 0; j < Size; ++j) {
+                (i == j ? total : off) += std::norm(D(i, j));
+            }
+        }
+        if (std::sqrt(off) <= tol * std::sqrt(off + total)) {
+            break;
+        }
+
+        for (IndexType p = 0; p < Size; ++p) {
+            for (IndexType q = p + 1; q < Size; ++q) {
+                Real c;
+                Real s;
+                T e;
+                GetHermitianJacobiRotation(std::real(D(p, p)),
+                                           std::real(D(q, q)), D(p, q), c, s,
+                                           e);
+
+                RotateFixedColumns(D, p, q, c, s, e);
+                RotateFixedColumns(U, p, q, c, s, e);
+                for (IndexType j = 0; j < Size; ++j) {
+                    auto lhs = D(p, j);
+                    auto rhs = e * D(q, j);
+                    D(p, j) = c * lhs - s * rhs;
+                    D(q, j) = s * lhs + c * rhs;
+                }
+
+                D(p, q) = T{0};
+                D(q, p) = T{0};
+            }
+        }
+    }
+
+    for (IndexType i = 0; i < Size; ++i) {
+        for (IndexType j = 0; j < Size; ++j) {
+            D(i, j) = (i == j) ? T{std::real(D(i, j))} : T{0};
+        }
+    }
+
+    return {D, U};
+}
+
+// One-sided Jacobi method: the columns of A * V become orthogonal, are
+// sorted by the norm, and the QR factorization of them gives the full U.
+template <Utils::FloatOrComplex T, IndexType Rows, IndexType Cols>
+FixedSingularBasis<T, Rows, Cols>
+FixedJacobiSVD(const Matrix<T, Rows, Cols> &A) {
+    using Real = Utils::RealType<T>;
+
+    if constexpr (Rows < Cols) {
+        auto [U, S, VT] =
+            FixedJacobiSVD(Matrix<T, Rows, Cols>::Conjugated(A));
+        return {Matrix<T, Rows, Rows>::Conjugated(VT), S,
+                Matrix<T, Cols, Cols>::Conjugated(U)};
+    } else {
+        auto W = A;
+        auto V = Matrix<T, Cols, Cols>::Identity();
+        auto tol = std::numeric_limits<Real>::epsilon() * Real{Rows};
+
+        for (IndexType sweep = 0; sweep < kFixedJacobiMaxSweeps; ++sweep) {
+            bool converged = true;
+
+            for (IndexType p = 0; p < Cols; ++p) {
+                for (IndexType q = p + 1; q < Cols; ++q) {
+                    Real alpha = 0;
+                    Real beta = 0;
+                    T gamma = 0;
+                    for (IndexType i = 0; i < Rows; ++i) {
+                        alpha += std::norm(W(i, p));
+                        beta += std::norm(W(i, q));
+                        gamma += Utils::Conj(W(i, p)) * W(i, q);
+                    }
+
+                    if (std::abs(gamma) <= tol * std::sqrt(alpha * beta)) {
+                        continue;
+                    }
+                    converged = false;
+
+                    Real c;
+                    Real s;
+                    T e;
+                    GetHermitianJacobiRotation(alpha, beta, gamma, c, s, e);
+                    RotateFixedColumns(W, p, q, c, s, e);
+                    RotateFixedColumns(V, p, q, c, s, e);
+                }
+            }
+
+            if (converged) {
+                break;
+            }
+        }
+
+        Real norms[Cols > 0 ? Cols : 1];
+        for (IndexType j = 0; j < Cols; ++j) {
+            norms[j] = 0;
+            for (IndexType i = 0; i < Rows; ++i) {
+                norms[j] += std::norm(W(i, j));
+            }
+        }
+        for (IndexType j = 0; j < Cols; ++j) {
+            auto best = j;
+            for (IndexType k = j + 1; k < Cols; ++k) {
+                best = (norms[k] > norms[best]) ? k : best;
+            }
+            if (best == j) {
+                continue;
+            }
+
+            std::swap(norms[j], norms[best]);
+            for (IndexType i = 0; i < Rows; ++i) {
+                std::swap(W(i, j), W(i, best));
+            }
+            for (IndexType i = 0; i < Cols; ++i) {
+                std::swap(V(i, j), V(i, best));
+            }
+        }
+
+        // The columns of W are orthogonal, so R is diagonal, and its phases
+        // go to U.
+        auto [U, R] = FixedHouseholderQR(W);
+        Matrix<T, 1, Cols> S;
+        for (IndexType j = 0; j < Cols; ++j) {
+            auto abs_r = std::abs(R(j, j));
+            S(0, j) = abs_r;
+            auto phase = (abs_r > 0) ? R(j, j) / abs_r : T{1};
+            for (IndexType i = 0; i < Rows; ++i) {
+                U(i, j) *= phase;
+            }
+        }
+
+        return {U, S, Matrix<T, Cols, Cols>::Conjugated(V)};
+    }
+}
+} // namespace Details
+} // namespace LinearKit::Algorithm
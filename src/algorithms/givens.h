@@ -12,7 +12,8 @@ struct GivensPair {
 
 template <Utils::FloatOrComplex T = long double>
 GivensPair<T> GetGivensCoefficients(T first_elem, T second_elem) {
-    auto sqrt_abs = std::sqrt(std::norm(first_elem) + std::norm(second_elem));
+    auto sqrt_abs =
+        Utils::Sqrt(Utils::Norm(first_elem) + Utils::Norm(second_elem));
 
     if (Utils::IsZeroFloating(sqrt_abs)) {
         return {T{1}, T{0}};
@@ -3,6 +3,8 @@
 #include "../matrix_utils/checks.h"
 #include "householder.h"
 
+#include <vector>
+
 namespace LinearKit::Algorithm {
 namespace Details {
 template <Utils::FloatOrComplex T = long double>
@@ -10,9 +12,120 @@ struct HessenbergBasis {
     Matrix<T> H;
     Matrix<T> Q;
 };
-} // namespace Details
 
-using IndexType = LinearKit::Details::Types::IndexType;
+inline constexpr IndexType kHessenbergBlockSize = 32;
+
+// H together with the reflectors I - tau_i * v_i * v_i^H reducing to it,
+// v_i is stored in the i-th column starting from the row i + 1. Q is formed
+// only on request.
+template <Utils::FloatOrComplex T = long double>
+struct HessenbergReflectors {
+    Matrix<T> H;
+    Matrix<T> vectors;
+    std::vector<T> tau;
+
+    Matrix<T> GetQ(IndexType block = kHessenbergBlockSize) const {
+        if (tau.empty()) {
+            return Matrix<T>::Identity(H.Rows());
+        }
+        return AccumulateReflectors(vectors, tau, 1, block);
+    }
+};
+
+// Reduces the columns [from, from + width) of H. The reflectors of the panel
+// are applied to the right of the rest of the matrix only through the
+// returned Y = A * V * T, where Q_panel = I - V * T * V^H.
+template <Utils::FloatOrComplex T>
+Matrix<T> ReduceHessenbergPanel(HessenbergReflectors<T> &reduction,
+                                Matrix<T> &T_block, IndexType from,
+                                IndexType width) {
+    auto &[H, vectors, tau] = reduction;
+    auto size = H.Rows();
+
+    Matrix<T> Y(size, width);
+    std::vector<T> column(size);
+    std::vector<T> proj(width);
+
+    for (IndexType i = 0; i < width; ++i) {
+        auto c = from + i;
+
+        for (IndexType r = 0; r < size; ++r) {
+            column[r] = H(r, c);
+            for (IndexType k = 0; k < i; ++k) {
+                column[r] -= Y(r, k) * Utils::Conj(vectors(c, from + k));
+            }
+        }
+
+        // Left application of the previous reflectors: (I - V * T^H * V^H).
+        for (IndexType k = 0; k < i; ++k) {
+            proj[k] = T{0};
+            for (IndexType r = from + k + 1; r < size; ++r) {
+                proj[k] += Utils::Conj(vectors(r, from + k)) * column[r];
+            }
+        }
+
+        for (IndexType k = i - 1; k >= 0; --k) {
+            T sum = 0;
+            for (IndexType j = 0; j <= k; ++j) {
+                sum += Utils::Conj(T_block(j, k)) * proj[j];
+            }
+            proj[k] = sum;
+        }
+
+        for (IndexType k = 0; k < i; ++k) {
+            for (IndexType r = from + k + 1; r < size; ++r) {
+                column[r] -= vectors(r, from + k) * proj[k];
+            }
+        }
+
+        for (IndexType r = c + 1; r < size; ++r) {
+            vectors(r, c) = column[r];
+        }
+
+        auto v = vectors.GetSubmatrix({c + 1, size}, {c, c + 1});
+        auto [tau_c, beta] = HouseholderGenerate(v);
+        tau[c] = tau_c;
+
+        for (IndexType r = 0; r <= c; ++r) {
+            H(r, c) = column[r];
+        }
+        H(c + 1, c) = beta;
+        for (IndexType r = c + 2; r < size; ++r) {
+            H(r, c) = T{0};
+        }
+
+        // w = V^H * v_i gives both the new column of T and of Y.
+        for (IndexType k = 0; k < i; ++k) {
+            proj[k] = T{0};
+            for (IndexType r = c + 1; r < size; ++r) {
+                proj[k] += Utils::Conj(vectors(r, from + k)) * vectors(r, c);
+            }
+        }
+
+        for (IndexType r = 0; r < size; ++r) {
+            T sum = 0;
+            for (IndexType j = c + 1; j < size; ++j) {
+                sum += H(r, j) * vectors(j, c);
+            }
+            for (IndexType k = 0; k < i; ++k) {
+                sum -= Y(r, k) * proj[k];
+            }
+            Y(r, i) = tau_c * sum;
+        }
+
+        for (IndexType k = 0; k < i; ++k) {
+            T sum = 0;
+            for (IndexType j = k; j < i; ++j) {
+                sum += T_block(k, j) * proj[j];
+            }
+            T_block(k, i) = -tau_c * sum;
+        }
+        T_block(i, i) = tau_c;
+    }
+
+    return Y;
+}
+} // namespace Details
 
 template <MatrixUtils::MatrixType M>
 Details::HessenbergBasis<typename M::ElemType>
@@ -31,11 +144,63 @@ GetHessenbergForm(const M &matrix) {
 
         HouseholderLeftReflection(Q, vec, col + 1);
         HouseholderLeftReflection(H, vec, col + 1, col);
-        HouseholderRightReflection(H, vec.Conjugate(), col + 1, 0);
+        HouseholderRightReflection(H, Matrix<T>::Conjugated(vec), col + 1, 0);
     }
 
     Q.Conjugate();
     H.RoundZeroes();
     return {std::move(H), std::move(Q)};
 }
+
+// Blocked reduction: the trailing matrix is updated by matrix products once
+// per panel, Q is kept as the reflectors.
+template <MatrixUtils::MatrixType M>
+Details::HessenbergReflectors<typename M::ElemType>
+ReduceToHessenberg(const M &matrix,
+                   IndexType block = Details::kHessenbergBlockSize) {
+    using T = typename M::ElemType;
+
+    assert(MatrixUtils::IsSquare(matrix) &&
+           "Hessenberg form for square matrices");
+    assert(block > 0 && "Block size must be positive.");
+
+    auto size = matrix.Rows();
+    auto steps = std::max(size - 2, IndexType{0});
+
+    Details::HessenbergReflectors<T> reduction{
+        matrix, Matrix<T>(size, steps), std::vector<T>(steps, T{0})};
+
+    for (IndexType from = 0; from < steps; from += block) {
+        auto width = std::min(block, steps - from);
+        Matrix<T> T_block(width, width);
+
+        auto Y = Details::ReduceHessenbergPanel(reduction, T_block, from,
+                                                width);
+
+        auto next = from + width;
+        auto &H = reduction.H;
+        const auto &vectors = reduction.vectors;
+
+        auto trailing = H.GetSubmatrix({0, size}, {next, size});
+        trailing -= Y * Matrix<T>::Conjugated(
+                            vectors.GetSubmatrix({next, size}, {from, next}));
+
+        Matrix<T> V = vectors.GetSubmatrix({from + 1, size}, {from, next});
+        auto lower = H.GetSubmatrix({from + 1, size}, {next, size});
+        lower -= V * (Matrix<T>::Conjugated(T_block) *
+                      (Matrix<T>::Conjugated(V) * lower));
+    }
+
+    reduction.H.RoundZeroes();
+    return reduction;
+}
+
+template <MatrixUtils::MatrixType M>
+Details::HessenbergBasis<typename M::ElemType>
+GetBlockedHessenbergForm(const M &matrix,
+                         IndexType block = Details::kHessenbergBlockSize) {
+    auto reduction = ReduceToHessenberg(matrix, block);
+    auto Q = reduction.GetQ(block);
+    return {std::move(reduction.H), std::move(Q)};
+}
 } // namespace LinearKit::Algorithm
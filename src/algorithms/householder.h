@@ -2,8 +2,20 @@
 
 #include "../matrix_utils/is_matrix_type.h"
 #include "../utils/sign.h"
+#include "../utils/thread_pool.h"
+#include "blas.h"
+
+#include <vector>
 
 namespace LinearKit::Algorithm {
+namespace Details {
+template <Utils::FloatOrComplex T = long double>
+struct ReflectorCoefficients {
+    T tau = T{0};
+    T beta = T{0};
+};
+} // namespace Details
+
 using IndexType = LinearKit::Details::Types::IndexType;
 
 template <MatrixUtils::MutableMatrixType M>
@@ -12,6 +24,145 @@ void HouseholderReduction(M &vector) {
     vector.Normalize();
 }
 
+// Turns the column x into v with v(0) = 1, such that H = I - tau * v * v^H
+// satisfies H^H * x = beta * e_1 with real beta.
+template <MatrixUtils::MutableMatrixType M>
+Details::ReflectorCoefficients<typename M::ElemType>
+HouseholderGenerate(M &vector) {
+    using T = typename M::ElemType;
+
+    auto alpha = vector(0, 0);
+    Utils::RealType<T> tail_norm = 0;
+    for (IndexType i = 1; i < vector.Rows(); ++i) {
+        tail_norm += Utils::Norm(vector(i, 0));
+    }
+
+    vector(0, 0) = T{1};
+    if (tail_norm == 0 && Utils::Imag(alpha) == 0) {
+        return {T{0}, alpha};
+    }
+
+    auto norm = Utils::Sqrt(Utils::Norm(alpha) + tail_norm);
+    T beta = (Utils::Real(alpha) >= 0) ? -norm : norm;
+
+    auto scale = T{1} / (alpha - beta);
+    for (IndexType i = 1; i < vector.Rows(); ++i) {
+        vector(i, 0) *= scale;
+    }
+
+    return {(beta - alpha) / beta, beta};
+}
+
+// Upper triangular T with H_from * ... * H_(from + width - 1) =
+// I - V * T * V^H, where the i-th column of V starts from its row i.
+template <Utils::FloatOrComplex T>
+Matrix<T> FormBlockReflector(const Matrix<T> &V, const std::vector<T> &tau,
+                             IndexType from) {
+    auto width = V.Columns();
+    Matrix<T> T_block(width, width);
+
+    for (IndexType i = 0; i < width; ++i) {
+        T_block(i, i) = tau[from + i];
+
+        for (IndexType j = 0; j < i; ++j) {
+            T dot = 0;
+            for (IndexType r = i; r < V.Rows(); ++r) {
+                dot += Utils::Conj(V(r, j)) * V(r, i);
+            }
+
+            for (IndexType k = 0; k <= j; ++k) {
+                T_block(k, i) -= tau[from + i] * T_block(k, j) * dot;
+            }
+        }
+    }
+
+    return T_block;
+}
+
+// B[row:, :] = (I - V * T * V^H) * B[row:, :], or its adjoint, by column
+// tiles on the thread pool.
+template <Utils::FloatOrComplex T, MatrixUtils::MutableMatrixType M>
+void ApplyBlockReflector(const Matrix<T> &V, const Matrix<T> &T_block, M &B,
+                         IndexType row, bool is_adjoint) {
+    constexpr IndexType kTile = 64;
+
+    auto width = V.Columns();
+    auto col_tiles = (B.Columns() + kTile - 1) / kTile;
+
+    Utils::ParallelFor(0, col_tiles, [&](std::ptrdiff_t tile) {
+        auto j_from = tile * kTile;
+        auto j_to = std::min(B.Columns(), j_from + kTile);
+        Matrix<T> W(width, j_to - j_from);
+
+        for (IndexType k = 0; k < width; ++k) {
+            for (IndexType r = k; r < V.Rows(); ++r) {
+                auto coeff = Utils::Conj(V(r, k));
+                for (IndexType j = j_from; j < j_to; ++j) {
+                    W(k, j - j_from) += coeff * B(row + r, j);
+                }
+            }
+        }
+
+        Matrix<T> TW(width, j_to - j_from);
+        for (IndexType i = 0; i < width; ++i) {
+            for (IndexType k = 0; k < width; ++k) {
+                auto coeff = is_adjoint ? Utils::Conj(T_block(k, i))
+                                        : T_block(i, k);
+                if (coeff == T{0}) {
+                    continue;
+                }
+                for (IndexType j = 0; j < j_to - j_from; ++j) {
+                    TW(i, j) += coeff * W(k, j);
+                }
+            }
+        }
+
+        for (IndexType r = 0; r < V.Rows(); ++r) {
+            for (IndexType k = 0; k <= std::min(r, width - 1); ++k) {
+                auto coeff = V(r, k);
+                for (IndexType j = j_from; j < j_to; ++j) {
+                    B(row + r, j) -= coeff * TW(k, j - j_from);
+                }
+            }
+        }
+    });
+}
+
+// Product H_0 * H_1 * ... of reflectors I - tau_i * v_i * v_i^H, where v_i is
+// the i-th column of vectors starting from the row i + shift. The product is
+// accumulated backwards by blocks: (I - V * T * V^H) * Q.
+template <Utils::FloatOrComplex T>
+Matrix<T> AccumulateReflectors(const Matrix<T> &vectors,
+                               const std::vector<T> &tau, IndexType shift,
+                               IndexType block) {
+    auto size = vectors.Rows();
+    IndexType count = tau.size();
+    Matrix<T> Q = Matrix<T>::Identity(size);
+
+    if (count == 0) {
+        return Q;
+    }
+
+    for (auto from = ((count - 1) / block) * block; from >= 0; from -= block) {
+        auto top = from + shift;
+        auto width = std::min(block, count - from);
+
+        if (top >= size) {
+            continue;
+        }
+
+        width = std::min(width, size - top);
+        Matrix<T> V = vectors.GetSubmatrix({top, size}, {from, from + width});
+        auto T_block = FormBlockReflector(V, tau, from);
+
+        auto Q_sub = Q.GetSubmatrix({top, size}, {top, size});
+        Gemm(T{-1}, V, T_block * (Matrix<T>::Conjugated(V) * Q_sub), T{1},
+             Q_sub);
+    }
+
+    return Q;
+}
+
 template <MatrixUtils::MutableMatrixType M, MatrixUtils::MatrixType V>
 void HouseholderLeftReflection(M &matrix, const V &vec, IndexType row = 0,
                                IndexType c_from = 0, IndexType c_to = -1) {
@@ -23,7 +174,7 @@ void HouseholderLeftReflection(M &matrix, const V &vec, IndexType row = 0,
 
     MatrixView<T> sub =
         matrix.GetSubmatrix({row, row + vec.Rows()}, {c_from, c_to});
-    sub -= (T{2} * vec) * (Matrix<T>::Conjugated(vec) * sub);
+    Gemm(T{-2}, vec, Matrix<T>::Conjugated(vec) * sub, T{1}, sub);
 }
 
 template <MatrixUtils::MutableMatrixType M, MatrixUtils::MatrixType V>
@@ -37,6 +188,6 @@ void HouseholderRightReflection(M &matrix, const V &vec, IndexType col = 0,
 
     MatrixView<T> sub =
         matrix.GetSubmatrix({r_from, r_to}, {col, col + vec.Columns()});
-    sub -= (sub * Matrix<T>::Conjugated(vec)) * (T{2} * vec);
+    Gemm(T{-2}, sub * Matrix<T>::Conjugated(vec), vec, T{1}, sub);
 }
 } // namespace LinearKit::Algorithm
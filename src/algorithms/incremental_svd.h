@@ -0,0 +1,206 @@
+#pragma once
+
+#include "svd.h"
+
+#include <vector>
+
+namespace LinearKit::Algorithm {
+// Truncated SVD A ~ U * diag(sigma) * V^H of a matrix growing by columns,
+// updated by the method of Brand. New columns C are split into the part
+// U * L in the current subspace and the residual J * K with orthonormal J;
+// then the small core [[diag(sigma), L], [0, K]] is diagonalized, and its
+// singular vectors rotate [U, J] and the extended V. An update costs
+// O((m + n) * (k + c)^2) for k kept and c new columns.
+template <Utils::FloatOrComplex T>
+class IncrementalSVD {
+    using Real = Utils::RealType<T>;
+
+public:
+    // The SVD of a matrix with rows rows and no columns. At most max_rank
+    // singular values are kept, together with those above tol * sigma_max.
+    IncrementalSVD(IndexType rows, IndexType max_rank, Real tol = Real{0})
+        : rows_(rows), max_rank_(max_rank), tol_(tol) {
+        assert(max_rank > 0 && "Rank must be positive.");
+        assert(tol >= 0 && "Tolerance must be non-negative.");
+    }
+
+    template <MatrixUtils::MatrixType M>
+    IncrementalSVD(const M &matrix, IndexType max_rank, Real tol = Real{0})
+        : IncrementalSVD(matrix.Rows(), max_rank, tol) {
+        AppendColumns(matrix);
+    }
+
+    [[nodiscard]] IndexType Rows() const {
+        return rows_;
+    }
+
+    [[nodiscard]] IndexType Columns() const {
+        return cols_;
+    }
+
+    [[nodiscard]] IndexType Rank() const {
+        return sigma_.size();
+    }
+
+    // m x Rank().
+    const Matrix<T> &GetU() const {
+        return U_;
+    }
+
+    // n x Rank().
+    const Matrix<T> &GetV() const {
+        return V_;
+    }
+
+    const std::vector<Real> &GetSingularValues() const {
+        return sigma_;
+    }
+
+    Matrix<T> Reconstruct() const {
+        Matrix<T> result(rows_, cols_);
+        for (IndexType i = 0; i < rows_; ++i) {
+            for (IndexType k = 0; k < Rank(); ++k) {
+                auto coeff = U_(i, k) * sigma_[k];
+                for (IndexType j = 0; j < cols_; ++j) {
+                    result(i, j) += coeff * Utils::Conj(V_(j, k));
+                }
+            }
+        }
+
+        return result;
+    }
+
+    template <MatrixUtils::MatrixType M>
+    void AppendColumns(const M &columns) {
+        assert(columns.Rows() == rows_ && "Wrong number of rows.");
+
+        auto added = columns.Columns();
+        if (added == 0) {
+            return;
+        }
+        if (rows_ == 0) {
+            cols_ += added;
+            return;
+        }
+
+        auto rank = Rank();
+
+        // L = U^H * C and H = C - U * L, projected twice for the
+        // orthogonality of H to U.
+        Matrix<T> H = columns;
+        Matrix<T> L(std::max(rank, IndexType{1}), added);
+        for (int pass = 0; pass < 2 && rank > 0; ++pass) {
+            Matrix<T> projection(rank, added);
+            for (IndexType i = 0; i < rows_; ++i) {
+                for (IndexType k = 0; k < rank; ++k) {
+                    auto coeff = Utils::Conj(U_(i, k));
+                    for (IndexType j = 0; j < added; ++j) {
+                        projection(k, j) += coeff * H(i, j);
+                    }
+                }
+            }
+
+            for (IndexType i = 0; i < rows_; ++i) {
+                for (IndexType k = 0; k < rank; ++k) {
+                    auto coeff = U_(i, k);
+                    for (IndexType j = 0; j < added; ++j) {
+                        H(i, j) -= coeff * projection(k, j);
+                    }
+                }
+            }
+
+            for (IndexType k = 0; k < rank; ++k) {
+                for (IndexType j = 0; j < added; ++j) {
+                    L(k, j) += projection(k, j);
+                }
+            }
+        }
+
+        // H = J * K with orthonormal J of residual columns.
+        auto residual = std::min(rows_, added);
+        auto factor = CompactQR(H);
+        Matrix<T> J(rows_, residual);
+        for (IndexType i = 0; i < residual; ++i) {
+            J(i, i) = T{1};
+        }
+        factor.ApplyQ(J, false);
+
+        Matrix<T> core(rank + residual, rank + added);
+        for (IndexType k = 0; k < rank; ++k) {
+            core(k, k) = sigma_[k];
+            for (IndexType j = 0; j < added; ++j) {
+                core(k, rank + j) = L(k, j);
+            }
+        }
+        for (IndexType i = 0; i < residual; ++i) {
+            for (IndexType j = i; j < added; ++j) {
+                core(rank + i, rank + j) = factor.QR(i, j);
+            }
+        }
+
+        auto [U_core, S_core, VT_core] = SVD(core);
+
+        std::vector<Real> sigma;
+        for (IndexType i = 0; i < S_core.Rows(); ++i) {
+            for (IndexType j = 0; j < S_core.Columns(); ++j) {
+                sigma.push_back(Utils::Real(S_core(i, j)));
+            }
+        }
+
+        IndexType keep = std::min<IndexType>(max_rank_, sigma.size());
+        while (keep > 0 && !(sigma[keep - 1] > tol_ * sigma.front())) {
+            --keep;
+        }
+        sigma.resize(keep);
+
+        // U = [U, J] * U_core and V = [[V, 0], [0, I]] * V_core over the kept
+        // columns.
+        Matrix<T> U(rows_, std::max(keep, IndexType{1}));
+        for (IndexType i = 0; i < rows_; ++i) {
+            for (IndexType k = 0; k < rank + residual; ++k) {
+                auto coeff = (k < rank) ? U_(i, k) : J(i, k - rank);
+                for (IndexType j = 0; j < keep; ++j) {
+                    U(i, j) += coeff * U_core(k, j);
+                }
+            }
+        }
+
+        Matrix<T> V(cols_ + added, std::max(keep, IndexType{1}));
+        for (IndexType i = 0; i < cols_; ++i) {
+            for (IndexType k = 0; k < rank; ++k) {
+                auto coeff = V_(i, k);
+                for (IndexType j = 0; j < keep; ++j) {
+                    V(i, j) += coeff * Utils::Conj(VT_core(j, k));
+                }
+            }
+        }
+        for (IndexType i = 0; i < added; ++i) {
+            for (IndexType j = 0; j < keep; ++j) {
+                V(cols_ + i, j) = Utils::Conj(VT_core(j, rank + i));
+            }
+        }
+
+        U_ = std::move(U);
+        V_ = std::move(V);
+        sigma_ = std::move(sigma);
+        cols_ += added;
+    }
+
+private:
+    IndexType rows_;
+    IndexType cols_ = 0;
+    IndexType max_rank_;
+    Real tol_;
+    Matrix<T> U_;
+    Matrix<T> V_;
+    std::vector<Real> sigma_;
+};
+
+template <MatrixUtils::MatrixType M>
+IncrementalSVD(const M &, IndexType)
+    -> IncrementalSVD<typename M::ElemType>;
+
+template <MatrixUtils::MatrixType M>
+IncrementalSVD(const M &, IndexType, Utils::RealType<typename M::ElemType>)
+    -> IncrementalSVD<typename M::ElemType>;
+} // namespace LinearKit::Algorithm
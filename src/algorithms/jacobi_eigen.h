@@ -0,0 +1,225 @@
+#pragma once
+
+#include "cholesky_qr.h"
+
+#include <limits>
+
+namespace LinearKit::Algorithm {
+namespace Details {
+inline constexpr IndexType kWarmJacobiMaxSweeps = 8;
+inline constexpr IndexType kColdJacobiMaxSweeps = 50;
+inline constexpr IndexType kSpectralTileSize = 32;
+
+// A = U * D * U^H. sweeps is the number of Jacobi sweeps done, is_restarted
+// tells that the initial basis was dropped. is_converged is false if the
+// restart did not converge in kColdJacobiMaxSweeps either; then sweeps is
+// kColdJacobiMaxSweeps and D is the diagonal of the last iterate.
+template <Utils::FloatOrComplex T = long double>
+struct RefinedSpectralPair {
+    Matrix<T> D;
+    Matrix<T> U;
+    IndexType sweeps = 0;
+    bool is_restarted = false;
+    bool is_converged = true;
+};
+
+template <Utils::FloatOrComplex T>
+std::pair<Utils::RealType<T>, Utils::RealType<T>>
+GetOffDiagonalNorms(const Matrix<T> &B) {
+    Utils::RealType<T> off = 0;
+    Utils::RealType<T> diag = 0;
+    for (IndexType i = 0; i < B.Rows(); ++i) {
+        for (IndexType j = 0; j < B.Columns(); ++j) {
+            (i == j ? diag : off) += std::norm(B(i, j));
+        }
+    }
+
+    return {std::sqrt(off), std::sqrt(off + diag)};
+}
+
+// Cyclic Jacobi sweeps for the Hermitian B, accumulating the rotations in
+// the columns of V. Each rotation W = diag(1, conj(e)) * [[c, s], [-s, c]]
+// turns the phase of B(p, q) into a real one first. Returns the number of
+// sweeps, or -1 if the off-diagonal part did not vanish in max_sweeps.
+template <Utils::FloatOrComplex T>
+IndexType JacobiEigenSweeps(Matrix<T> &B, Matrix<T> &V, IndexType max_sweeps) {
+    using Real = Utils::RealType<T>;
+
+    auto size = B.Rows();
+    auto tol = std::numeric_limits<Real>::epsilon() *
+               static_cast<Real>(std::max(size, IndexType{1}));
+
+    for (IndexType sweep = 0; sweep <= max_sweeps; ++sweep) {
+        auto [off, total] = GetOffDiagonalNorms(B);
+        if (off <= tol * total) {
+            return sweep;
+        }
+        if (sweep == max_sweeps) {
+            break;
+        }
+
+        for (IndexType p = 0; p < size; ++p) {
+            for (IndexType q = p + 1; q < size; ++q) {
+                auto b = B(p, q);
+                auto abs_b = std::abs(b);
+                if (abs_b == 0) {
+                    continue;
+                }
+
+                auto e = b / abs_b;
+                auto zeta = (std::real(B(q, q)) - std::real(B(p, p))) /
+                            (2 * abs_b);
+                auto t = ((zeta >= 0) ? Real{1} : Real{-1}) /
+                         (std::abs(zeta) + std::sqrt(1 + zeta * zeta));
+                auto c = 1 / std::sqrt(1 + t * t);
+                auto s = c * t;
+
+                // B = B * W and V = V * W.
+                for (auto *A : {&B, &V}) {
+                    for (IndexType i = 0; i < A->Rows(); ++i) {
+                        auto first = (*A)(i, p);
+                        auto second = Utils::Conj(e) * (*A)(i, q);
+                        (*A)(i, p) = c * first - s * second;
+                        (*A)(i, q) = s * first + c * second;
+                    }
+                }
+
+                // B = W^H * B.
+                auto *row_p = &B(p, 0);
+                auto *row_q = &B(q, 0);
+                for (IndexType j = 0; j < size; ++j) {
+                    auto first = row_p[j];
+                    auto second = e * row_q[j];
+                    row_p[j] = c * first - s * second;
+                    row_q[j] = s * first + c * second;
+                }
+
+                B(p, q) = T{0};
+                B(q, p) = T{0};
+                B(p, p) = std::real(B(p, p));
+                B(q, q) = std::real(B(q, q));
+            }
+        }
+    }
+
+    return -1;
+}
+
+// U^H * A * U with the result made exactly Hermitian.
+template <MatrixUtils::MatrixType M>
+Matrix<typename M::ElemType>
+ProjectHermitian(const M &A, const Matrix<typename M::ElemType> &U) {
+    using T = typename M::ElemType;
+
+    auto size = A.Rows();
+    auto tiles = (size + kSpectralTileSize - 1) / kSpectralTileSize;
+
+    Matrix<T> AU(size, size);
+    Utils::ParallelFor(0, tiles, [&](std::ptrdiff_t tile) {
+        auto i_to = std::min(size, (tile + 1) * kSpectralTileSize);
+        for (IndexType i = tile * kSpectralTileSize; i < i_to; ++i) {
+            auto *row = &AU(i, 0);
+            for (IndexType k = 0; k < size; ++k) {
+                auto coeff = A(i, k);
+                for (IndexType j = 0; j < size; ++j) {
+                    row[j] += coeff * U(k, j);
+                }
+            }
+        }
+    });
+
+    Matrix<T> B(size, size);
+    Utils::ParallelFor(0, tiles, [&](std::ptrdiff_t tile) {
+        auto i_to = std::min(size, (tile + 1) * kSpectralTileSize);
+        for (IndexType i = tile * kSpectralTileSize; i < i_to; ++i) {
+            auto *row = &B(i, 0);
+            for (IndexType k = 0; k < size; ++k) {
+                auto coeff = Utils::Conj(U(k, i));
+                const auto *other = &AU(k, 0);
+                for (IndexType j = 0; j < size; ++j) {
+                    row[j] += coeff * other[j];
+                }
+            }
+        }
+    });
+
+    for (IndexType i = 0; i < size; ++i) {
+        B(i, i) = std::real(B(i, i));
+        for (IndexType j = 0; j < i; ++j) {
+            auto mean = (B(i, j) + Utils::Conj(B(j, i))) / T{2};
+            B(i, j) = mean;
+            B(j, i) = Utils::Conj(mean);
+        }
+    }
+
+    return B;
+}
+
+template <Utils::FloatOrComplex T>
+Matrix<T> GetRealDiagonal(const Matrix<T> &B) {
+    Matrix<T> D(B.Rows(), B.Columns());
+    for (IndexType i = 0; i < B.Rows(); ++i) {
+        D(i, i) = std::real(B(i, i));
+    }
+
+    return D;
+}
+} // namespace Details
+
+// Spectral decomposition of a Hermitian matrix starting from an approximate
+// eigenvector basis, e.g. the one of the previous value of a slowly changing
+// matrix. The basis is orthonormalized, A is projected onto it, and Jacobi
+// sweeps finish the diagonalization: near a diagonal matrix they converge
+// quadratically, so a few sweeps are enough. The eigenpairs keep the order of
+// the basis columns. If the off-diagonal part of the projection is above
+// max_drift relative to its norm, or the sweeps do not converge, the
+// decomposition restarts from the identity basis with the cyclic Jacobi
+// method.
+template <MatrixUtils::MatrixType M, MatrixUtils::MatrixType B>
+Details::RefinedSpectralPair<typename M::ElemType>
+RefineSpecDecomposition(const M &matrix, const B &basis,
+                        Utils::RealType<typename M::ElemType> max_drift = 0.1,
+                        IndexType max_sweeps = Details::kWarmJacobiMaxSweeps) {
+    using T = typename M::ElemType;
+
+    static_assert(Utils::StandardFloatOrComplex<T>,
+                  "Jacobi refinement for the standard floating types.");
+    assert(MatrixUtils::IsSquare(matrix) &&
+           "Spectral decomposition for square matrices.");
+    assert(basis.Rows() == matrix.Rows() &&
+           basis.Columns() == matrix.Columns() && "Wrong size of the basis.");
+
+    auto size = matrix.Rows();
+    if (size == 0) {
+        return {};
+    }
+
+    Matrix<T> U = basis;
+    OrthonormalizeColumns(U);
+
+    auto projected = Details::ProjectHermitian(matrix, U);
+    auto [off, total] = Details::GetOffDiagonalNorms(projected);
+
+    if (off <= max_drift * total) {
+        auto sweeps = Details::JacobiEigenSweeps(projected, U, max_sweeps);
+        if (sweeps >= 0) {
+            return {Details::GetRealDiagonal(projected), std::move(U), sweeps,
+                    false};
+        }
+    }
+
+    Matrix<T> V = Matrix<T>::Identity(size);
+    Matrix<T> cold = matrix;
+    for (IndexType i = 0; i < size; ++i) {
+        cold(i, i) = std::real(cold(i, i));
+    }
+
+    auto sweeps = Details::JacobiEigenSweeps(cold, V,
+                                             Details::kColdJacobiMaxSweeps);
+    if (sweeps < 0) {
+        return {Details::GetRealDiagonal(cold), std::move(V),
+                Details::kColdJacobiMaxSweeps, true, false};
+    }
+    return {Details::GetRealDiagonal(cold), std::move(V), sweeps, true};
+}
+} // namespace LinearKit::Algorithm
@@ -0,0 +1,347 @@
+#pragma once
+
+#include "../utils/thread_pool.h"
+#include "qr_decomposition.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+namespace LinearKit::Algorithm {
+namespace Details {
+template <Utils::FloatOrComplex T>
+struct SingularBasis {
+    Matrix<T> U;
+    Matrix<T> S;
+    Matrix<T> VT;
+};
+
+// The result of the one-sided Jacobi methods. sweeps is the number of sweeps
+// done, the last one without rotations if is_converged; is_converged is false
+// if max_sweeps ran out while the columns were still rotated.
+template <Utils::FloatOrComplex T>
+struct JacobiSingularBasis {
+    Matrix<T> U;
+    Matrix<T> S;
+    Matrix<T> VT;
+    IndexType sweeps = 0;
+    bool is_converged = true;
+};
+
+using IndexPair = std::pair<IndexType, IndexType>;
+
+inline std::vector<std::vector<IndexPair>> GetRoundRobinOrder(IndexType size) {
+    auto players = size + size % 2;
+    std::vector<IndexType> order(players);
+    std::iota(order.begin(), order.end(), IndexType{0});
+
+    std::vector<std::vector<IndexPair>> rounds;
+    rounds.reserve(players - 1);
+
+    for (IndexType round = 0; round + 1 < players; ++round) {
+        auto &pairs = rounds.emplace_back();
+        for (IndexType i = 0; i < players / 2; ++i) {
+            auto first = order[i];
+            auto second = order[players - 1 - i];
+
+            if (first < size && second < size) {
+                pairs.emplace_back(std::min(first, second),
+                                   std::max(first, second));
+            }
+        }
+
+        std::rotate(order.begin() + 1, order.end() - 1, order.end());
+    }
+
+    return rounds;
+}
+
+// Rows are contiguous in storage, so columns of the processed matrix are
+// kept as rows. Independent accumulators let the compiler vectorize the loop.
+template <Utils::FloatOrComplex T>
+T RowDot(const T *lhs, const T *rhs, IndexType size) {
+    T acc[4] = {T{0}, T{0}, T{0}, T{0}};
+
+    IndexType i = 0;
+    for (; i + 4 <= size; i += 4) {
+        for (IndexType k = 0; k < 4; ++k) {
+            if constexpr (Utils::Details::IsFloatComplexT<T>::value) {
+                acc[k] += std::conj(lhs[i + k]) * rhs[i + k];
+            } else {
+                acc[k] += lhs[i + k] * rhs[i + k];
+            }
+        }
+    }
+
+    for (; i < size; ++i) {
+        if constexpr (Utils::Details::IsFloatComplexT<T>::value) {
+            acc[0] += std::conj(lhs[i]) * rhs[i];
+        } else {
+            acc[0] += lhs[i] * rhs[i];
+        }
+    }
+
+    return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+template <Utils::FloatOrComplex T>
+void RotateRows(T *first, T *second, IndexType size,
+                Utils::RealType<T> cos, Utils::RealType<T> sin, T phase) {
+    for (IndexType i = 0; i < size; ++i) {
+        auto lhs = first[i];
+        auto rhs = second[i] * phase;
+
+        first[i] = cos * lhs - sin * rhs;
+        second[i] = sin * lhs + cos * rhs;
+    }
+}
+
+// A column that cancelled down to the rounding errors of the rotations is
+// left out. The errors are bounded by eps times the scale of the column, the
+// norm it would have without cancellation: the starting norm, carried
+// through the rotations as |cos| * own + |sin| * other. A small column of a
+// graded matrix keeps a small scale and is rotated as any other.
+//
+// The carried bound compounds over the sweeps, while the rotations never
+// raise the error of a column above the Frobenius norm of the matrix: the
+// scales are capped by it, so no threshold is looser than tol * ||A||_F.
+template <typename Real>
+struct JacobiScales {
+    std::vector<Real> column;
+    Real limit = 0;
+};
+
+template <typename Real>
+JacobiScales<Real> MakeJacobiScales(std::vector<Real> norms) {
+    Real limit = 0;
+    for (auto norm : norms) {
+        limit += norm * norm;
+    }
+
+    return {std::move(norms), Utils::Sqrt(limit)};
+}
+
+// The one noise rule, used both to skip the rotations of a column and to
+// replace its column of U.
+template <typename Real>
+bool IsJacobiNoise(Real norm, Real scale, Real tol) {
+    return norm <= tol * scale;
+}
+
+// A pair is left as is if either column is noise, or if it is orthogonal
+// relative to the column norms: alpha and beta are the squared norms, gamma
+// the absolute value of the product.
+template <typename Real>
+bool IsJacobiPairSkipped(Real alpha, Real beta, Real gamma, Real scale_p,
+                         Real scale_q, Real tol) {
+    if (IsJacobiNoise(Utils::Sqrt(alpha), scale_p, tol) ||
+        IsJacobiNoise(Utils::Sqrt(beta), scale_q, tol)) {
+        return true;
+    }
+
+    return gamma <= tol * Utils::Sqrt(alpha * beta) || gamma == Real{0};
+}
+
+template <typename Real>
+void RotateScales(JacobiScales<Real> &scales, IndexType p, IndexType q,
+                  Real cos, Real sin) {
+    auto &scale = scales.column;
+    auto scale_p = scale[p];
+    auto scale_q = scale[q];
+    auto sin_abs = Utils::Abs(sin);
+    scale[p] = std::min(cos * scale_p + sin_abs * scale_q, scales.limit);
+    scale[q] = std::min(sin_abs * scale_p + cos * scale_q, scales.limit);
+}
+
+template <Utils::FloatOrComplex T>
+bool JacobiPairRotation(Matrix<T> &W, Matrix<T> &V, IndexType p, IndexType q,
+                        Utils::RealType<T> tol,
+                        JacobiScales<Utils::RealType<T>> &scales) {
+    using Real = Utils::RealType<T>;
+
+    auto *w_p = &W(p, 0);
+    auto *w_q = &W(q, 0);
+
+    auto alpha = Utils::Real(RowDot(w_p, w_p, W.Columns()));
+    auto beta = Utils::Real(RowDot(w_q, w_q, W.Columns()));
+    auto gamma = RowDot(w_p, w_q, W.Columns());
+    auto gamma_abs = Utils::Abs(gamma);
+
+    if (IsJacobiPairSkipped(alpha, beta, gamma_abs, scales.column[p],
+                            scales.column[q], tol)) {
+        return false;
+    }
+
+    // The phase makes the pair product real, the rest is a real rotation.
+    T phase = gamma / gamma_abs;
+    if constexpr (Utils::Details::IsFloatComplexT<T>::value) {
+        phase = std::conj(phase);
+    }
+
+    auto zeta = (beta - alpha) / (Real{2} * gamma_abs);
+    auto tan = ((zeta >= Real{0}) ? Real{1} : Real{-1}) /
+               (Utils::Abs(zeta) + Utils::Sqrt(Real{1} + zeta * zeta));
+    auto cos = Real{1} / Utils::Sqrt(Real{1} + tan * tan);
+    auto sin = cos * tan;
+
+    RotateRows(w_p, w_q, W.Columns(), cos, sin, phase);
+    RotateRows(&V(p, 0), &V(q, 0), V.Columns(), cos, sin, phase);
+    RotateScales(scales, p, q, cos, sin);
+    return true;
+}
+
+// Rows not marked in is_basis are replaced by an orthonormal completion of the
+// marked ones. The Householder QR is done in full: the Hessenberg shortcut of
+// HouseholderQR would drop the small entries below the subdiagonal and leave
+// the completion orthogonal only to a rounded basis.
+template <Utils::FloatOrComplex T>
+void CompleteOrthonormalRows(Matrix<T> &basis,
+                             const std::vector<bool> &is_basis) {
+    IndexType rank = std::count(is_basis.begin(), is_basis.end(), true);
+    if (rank == basis.Rows()) {
+        return;
+    }
+
+    if (rank == 0) {
+        basis = Matrix<T>::Identity(basis.Rows());
+        return;
+    }
+
+    Matrix<T> thin(basis.Columns(), rank);
+    for (IndexType row = 0, j = 0; row < basis.Rows(); ++row) {
+        if (is_basis[row]) {
+            for (IndexType i = 0; i < basis.Columns(); ++i) {
+                thin(i, j) = basis(row, i);
+            }
+            ++j;
+        }
+    }
+
+    auto Q = CompactQR(std::move(thin)).GetQ();
+    for (IndexType row = 0, j = rank; row < basis.Rows(); ++row) {
+        if (!is_basis[row]) {
+            for (IndexType i = 0; i < basis.Columns(); ++i) {
+                basis(row, i) = Q(i, j);
+            }
+            ++j;
+        }
+    }
+}
+
+// Sorts the columns of W (kept as its rows) by their norms sigma and splits
+// them into U, S and V^H. A column is noise by the same IsJacobiNoise test
+// that skips its rotations, wherever it falls in the order; the converged
+// ones are orthogonal relative to their own norms, the noise ones are
+// replaced by the basis completion.
+template <Utils::FloatOrComplex T, typename Work, typename Real>
+JacobiSingularBasis<T> AssembleJacobiBasis(const Work &W, const Work &V,
+                                           const std::vector<Real> &sigma,
+                                           const std::vector<Real> &scale,
+                                           Real tol) {
+    auto rows = W.Columns();
+    auto cols = W.Rows();
+
+    std::vector<IndexType> perm(cols);
+    std::iota(perm.begin(), perm.end(), IndexType{0});
+    std::stable_sort(perm.begin(), perm.end(), [&](auto lhs, auto rhs) {
+        return sigma[lhs] > sigma[rhs];
+    });
+
+    Matrix<T> S(1, cols);
+    Matrix<T> U_rows(rows, rows);
+    Matrix<T> VT(cols, cols);
+    std::vector<bool> is_basis(rows, false);
+
+    for (IndexType k = 0; k < cols; ++k) {
+        auto idx = perm[k];
+        S(0, k) = T{sigma[idx]};
+
+        for (IndexType i = 0; i < cols; ++i) {
+            VT(k, i) = Utils::Conj(T{V(idx, i)});
+        }
+
+        if (!IsJacobiNoise(sigma[idx], scale[idx], tol)) {
+            for (IndexType i = 0; i < rows; ++i) {
+                U_rows(k, i) = W(idx, i) / sigma[idx];
+            }
+            is_basis[k] = true;
+        }
+    }
+
+    CompleteOrthonormalRows(U_rows, is_basis);
+    U_rows.Transpose();
+
+    return {std::move(U_rows), std::move(S), std::move(VT)};
+}
+} // namespace Details
+
+template <MatrixUtils::MatrixType M>
+Details::JacobiSingularBasis<typename M::ElemType>
+JacobiSVD(const M &matrix, IndexType max_sweeps = 30) {
+    using T = typename M::ElemType;
+    using Real = Utils::RealType<T>;
+
+    if (matrix.Rows() < matrix.Columns()) {
+        auto [U, S, VT, sweeps, is_converged] =
+            JacobiSVD(Matrix<T>::Conjugated(matrix), max_sweeps);
+        U.Conjugate();
+        VT.Conjugate();
+        return {std::move(VT), std::move(S), std::move(U), sweeps,
+                is_converged};
+    }
+
+    auto rows = matrix.Rows();
+    auto cols = matrix.Columns();
+
+    if (cols == 0) {
+        return {Matrix<T>::Identity(rows), Matrix<T>(), Matrix<T>()};
+    }
+
+    // Columns of the matrix are stored as rows of W. No QR preconditioning is
+    // done, since it would round off the small singular values.
+    Matrix<T> W = Matrix<T>::Transposed(matrix);
+
+    Matrix<T> V = Matrix<T>::Identity(cols);
+    auto tol = Utils::Sqrt(static_cast<Real>(rows)) *
+               std::numeric_limits<Real>::epsilon();
+    auto rounds = Details::GetRoundRobinOrder(cols);
+
+    std::vector<Real> norms(cols);
+    for (IndexType i = 0; i < cols; ++i) {
+        norms[i] =
+            Utils::Sqrt(Utils::Real(Details::RowDot(&W(i, 0), &W(i, 0), rows)));
+    }
+    auto scales = Details::MakeJacobiScales(std::move(norms));
+
+    IndexType sweeps = 0;
+    auto is_converged = false;
+    while (!is_converged && sweeps < max_sweeps) {
+        std::atomic<bool> is_rotated = false;
+
+        for (const auto &pairs : rounds) {
+            Utils::ParallelFor(0, pairs.size(), [&](std::ptrdiff_t idx) {
+                auto [p, q] = pairs[idx];
+                if (Details::JacobiPairRotation(W, V, p, q, tol, scales)) {
+                    is_rotated.store(true, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        ++sweeps;
+        is_converged = !is_rotated.load();
+    }
+
+    std::vector<Real> sigma(cols);
+    for (IndexType i = 0; i < cols; ++i) {
+        sigma[i] =
+            Utils::Sqrt(Utils::Real(Details::RowDot(&W(i, 0), &W(i, 0), rows)));
+    }
+
+    auto result =
+        Details::AssembleJacobiBasis<T>(W, V, sigma, scales.column, tol);
+    result.sweeps = sweeps;
+    result.is_converged = is_converged;
+    return result;
+}
+} // namespace LinearKit::Algorithm
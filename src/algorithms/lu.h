@@ -0,0 +1,242 @@
+#pragma once
+
+#include "../matrix_utils/cast_matrix.h"
+#include "../matrix_utils/is_matrix_type.h"
+#include "../utils/thread_pool.h"
+
+#include <vector>
+
+namespace LinearKit::Algorithm {
+using IndexType = LinearKit::Details::Types::IndexType;
+
+namespace Details {
+inline constexpr IndexType kLUBlockSize = 64;
+inline constexpr IndexType kLUTileSize = 64;
+
+// P * A = L * U packed into one matrix: the unit lower L under the diagonal
+// and U on and above it. The row i was swapped with the row pivots[i] at the
+// step i. singular is the first step with a zero pivot, or -1.
+template <Utils::FloatOrComplex T = long double>
+struct FactorLU {
+    Matrix<T> LU;
+    std::vector<IndexType> pivots;
+    IndexType singular = -1;
+
+    [[nodiscard]] bool IsSingular() const {
+        return singular != -1;
+    }
+
+    Matrix<T> GetL() const {
+        auto steps = static_cast<IndexType>(pivots.size());
+        Matrix<T> L(LU.Rows(), steps);
+
+        for (IndexType i = 0; i < LU.Rows(); ++i) {
+            for (IndexType j = 0; j < std::min(i, steps); ++j) {
+                L(i, j) = LU(i, j);
+            }
+            if (i < steps) {
+                L(i, i) = T{1};
+            }
+        }
+
+        return L;
+    }
+
+    Matrix<T> GetU() const {
+        auto steps = static_cast<IndexType>(pivots.size());
+        Matrix<T> U(steps, LU.Columns());
+
+        for (IndexType i = 0; i < steps; ++i) {
+            for (IndexType j = i; j < LU.Columns(); ++j) {
+                U(i, j) = LU(i, j);
+            }
+        }
+
+        return U;
+    }
+
+    Matrix<T> GetP() const {
+        std::vector<IndexType> order(LU.Rows());
+        for (IndexType i = 0; i < LU.Rows(); ++i) {
+            order[i] = i;
+        }
+        for (IndexType i = 0; i < static_cast<IndexType>(pivots.size()); ++i) {
+            std::swap(order[i], order[pivots[i]]);
+        }
+
+        Matrix<T> P(LU.Rows(), LU.Rows());
+        for (IndexType i = 0; i < LU.Rows(); ++i) {
+            P(i, order[i]) = T{1};
+        }
+
+        return P;
+    }
+
+    T Determinant() const {
+        assert(LU.Rows() == LU.Columns() &&
+               "Determinant for square matrices.");
+
+        T det = 1;
+        for (IndexType i = 0; i < LU.Rows(); ++i) {
+            det *= (pivots[i] != i) ? -LU(i, i) : LU(i, i);
+        }
+
+        return det;
+    }
+};
+
+template <Utils::FloatOrComplex T>
+void SwapRows(Matrix<T> &A, IndexType first, IndexType second,
+              IndexType c_from, IndexType c_to) {
+    if (first == second) {
+        return;
+    }
+
+    for (IndexType j = c_from; j < c_to; ++j) {
+        std::swap(A(first, j), A(second, j));
+    }
+}
+
+// A[r_from:r_to, c_from:c_to] -= A[r_from:r_to, k_from:k_to] *
+//                                A[k_from:k_to, c_from:c_to]
+// by tiles on the thread pool. The blocks must not overlap the updated one.
+template <Utils::FloatOrComplex T>
+void SubtractInnerProduct(Matrix<T> &A, IndexType r_from, IndexType r_to,
+                          IndexType c_from, IndexType c_to, IndexType k_from,
+                          IndexType k_to) {
+    if (r_from >= r_to || c_from >= c_to || k_from >= k_to) {
+        return;
+    }
+
+    auto row_tiles = (r_to - r_from + kLUTileSize - 1) / kLUTileSize;
+    auto col_tiles = (c_to - c_from + kLUTileSize - 1) / kLUTileSize;
+
+    Utils::ParallelFor(0, row_tiles * col_tiles, [&](std::ptrdiff_t tile) {
+        auto i_from = r_from + (tile / col_tiles) * kLUTileSize;
+        auto j_from = c_from + (tile % col_tiles) * kLUTileSize;
+        auto i_to = std::min(r_to, i_from + kLUTileSize);
+        auto j_to = std::min(c_to, j_from + kLUTileSize);
+
+        for (IndexType i = i_from; i < i_to; ++i) {
+            auto *row = &A(i, 0);
+            for (IndexType k = k_from; k < k_to; ++k) {
+                auto coeff = row[k];
+                const auto *other = &A(k, 0);
+                for (IndexType j = j_from; j < j_to; ++j) {
+                    row[j] -= coeff * other[j];
+                }
+            }
+        }
+    });
+}
+
+// A[from:to, c_from:c_to] = L^-1 * A[from:to, c_from:c_to], where L is the
+// unit lower triangle of A[from:to, from:to].
+template <Utils::FloatOrComplex T>
+void SolveUnitLower(Matrix<T> &A, IndexType from, IndexType to,
+                    IndexType c_from, IndexType c_to) {
+    if (c_from >= c_to) {
+        return;
+    }
+
+    auto col_tiles = (c_to - c_from + kLUTileSize - 1) / kLUTileSize;
+
+    Utils::ParallelFor(0, col_tiles, [&](std::ptrdiff_t tile) {
+        auto j_from = c_from + tile * kLUTileSize;
+        auto j_to = std::min(c_to, j_from + kLUTileSize);
+
+        for (IndexType i = from + 1; i < to; ++i) {
+            auto *row = &A(i, 0);
+            for (IndexType k = from; k < i; ++k) {
+                auto coeff = row[k];
+                const auto *other = &A(k, 0);
+                for (IndexType j = j_from; j < j_to; ++j) {
+                    row[j] -= coeff * other[j];
+                }
+            }
+        }
+    });
+}
+
+// Recursive factorization of the columns [c_from, c_to) of the panel
+// [p_from, p_to): the halves are factored in turn, and the right one is
+// updated by a triangular solve and a matrix product in between.
+template <Utils::FloatOrComplex T>
+void FactorPanelLU(FactorLU<T> &factor, IndexType p_from, IndexType p_to,
+                   IndexType c_from, IndexType c_to) {
+    auto &A = factor.LU;
+
+    if (c_to - c_from == 1) {
+        auto c = c_from;
+        auto pivot = c;
+        for (IndexType r = c + 1; r < A.Rows(); ++r) {
+            if (Utils::Abs(A(r, c)) > Utils::Abs(A(pivot, c))) {
+                pivot = r;
+            }
+        }
+
+        factor.pivots[c] = pivot;
+        SwapRows(A, c, pivot, p_from, p_to);
+
+        if (A(c, c) == T{0}) {
+            if (factor.singular == -1) {
+                factor.singular = c;
+            }
+            return;
+        }
+
+        auto inverse = T{1} / A(c, c);
+        for (IndexType r = c + 1; r < A.Rows(); ++r) {
+            A(r, c) *= inverse;
+        }
+        return;
+    }
+
+    auto mid = c_from + (c_to - c_from) / 2;
+    FactorPanelLU(factor, p_from, p_to, c_from, mid);
+
+    SolveUnitLower(A, c_from, mid, mid, c_to);
+    SubtractInnerProduct(A, mid, A.Rows(), mid, c_to, c_from, mid);
+
+    FactorPanelLU(factor, p_from, p_to, mid, c_to);
+}
+} // namespace Details
+
+// Right-looking blocked LU with partial pivoting, done in the storage of the
+// given matrix.
+template <Utils::FloatOrComplex T>
+Details::FactorLU<T> LU(Matrix<T> &&matrix,
+                        IndexType block = Details::kLUBlockSize) {
+    assert(block > 0 && "Block size must be positive.");
+
+    auto rows = matrix.Rows();
+    auto cols = matrix.Columns();
+    auto steps = std::min(rows, cols);
+
+    Details::FactorLU<T> factor{std::move(matrix),
+                                std::vector<IndexType>(steps)};
+    auto &A = factor.LU;
+
+    for (IndexType from = 0; from < steps; from += block) {
+        auto next = std::min(steps, from + block);
+
+        Details::FactorPanelLU(factor, from, next, from, next);
+
+        for (IndexType i = from; i < next; ++i) {
+            Details::SwapRows(A, i, factor.pivots[i], 0, from);
+            Details::SwapRows(A, i, factor.pivots[i], next, cols);
+        }
+
+        Details::SolveUnitLower(A, from, next, next, cols);
+        Details::SubtractInnerProduct(A, next, rows, next, cols, from, next);
+    }
+
+    return factor;
+}
+
+template <MatrixUtils::MatrixType M>
+Details::FactorLU<Utils::WideType<typename M::ElemType>>
+LU(const M &matrix, IndexType block = Details::kLUBlockSize) {
+    return LU(MatrixUtils::WidenMatrix(matrix), block);
+}
+} // namespace LinearKit::Algorithm
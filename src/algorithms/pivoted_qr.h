@@ -0,0 +1,314 @@
+#pragma once
+
+#include "solve.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace LinearKit::Algorithm {
+namespace Details {
+// A * P = Q * R, where the column j of A * P is the column permutation[j] of
+// A. Only the first rank reflectors are formed: the rows of R from rank on
+// are dropped, and residual is the largest column norm of the dropped block.
+template <Utils::FloatOrComplex T = long double>
+struct FactorPivotedQR : FactorQR<T> {
+    std::vector<IndexType> permutation;
+    IndexType rank = 0;
+    Utils::RealType<T> residual = 0;
+
+    Matrix<T> GetR() const {
+        const auto &QR = this->QR;
+
+        Matrix<T> R(QR.Rows(), QR.Columns());
+        for (IndexType i = 0; i < rank; ++i) {
+            for (IndexType j = i; j < QR.Columns(); ++j) {
+                R(i, j) = QR(i, j);
+            }
+        }
+
+        return R;
+    }
+
+    Matrix<T> GetP() const {
+        IndexType size = permutation.size();
+
+        Matrix<T> P(size, size);
+        for (IndexType j = 0; j < size; ++j) {
+            P(permutation[j], j) = T{1};
+        }
+
+        return P;
+    }
+};
+
+template <Utils::FloatOrComplex T>
+Utils::RealType<T> ColumnNorm(const Matrix<T> &A, IndexType col,
+                              IndexType from) {
+    Utils::RealType<T> sum = 0;
+    for (IndexType r = from; r < A.Rows(); ++r) {
+        sum += std::norm(A(r, col));
+    }
+
+    return std::sqrt(sum);
+}
+
+// Column norms of the trailing matrix: partial ones are downdated after each
+// step, full ones keep the value of the last recomputation.
+template <Utils::FloatOrComplex T>
+struct PivotNorms {
+    std::vector<T> partial;
+    std::vector<T> full;
+};
+
+// Reduces up to width columns of the panel starting at from, choosing the
+// pivots by the downdated norms. The trailing columns are not touched until
+// the end of the panel: the reflectors are kept in F with
+// A_updated = A - V * F^H, F being stored transposed, and only the current
+// row and column are updated (LAPACK laqps). The panel ends early when a
+// norm has to be recomputed or the next pivot norm is not above the
+// threshold. Returns the number of reduced columns and whether to stop.
+template <Utils::FloatOrComplex T>
+std::pair<IndexType, bool>
+ReducePivotedPanel(FactorPivotedQR<T> &factor,
+                   PivotNorms<Utils::RealType<T>> &norms, IndexType from,
+                   IndexType width, Utils::RealType<T> threshold) {
+    using Real = Utils::RealType<T>;
+
+    auto &A = factor.QR;
+    auto rows = A.Rows();
+    auto cols = A.Columns();
+
+    const auto kRecomputeBound =
+        std::sqrt(std::numeric_limits<Real>::epsilon());
+    constexpr IndexType kTile = 64;
+
+    Matrix<T> FT(width, cols);
+    std::vector<IndexType> recompute;
+    std::vector<T> aux(width);
+
+    IndexType done = 0;
+    bool stop = false;
+
+    while (done < width) {
+        auto rk = from + done;
+
+        auto pivot = std::max_element(norms.partial.begin() + rk,
+                                      norms.partial.end()) -
+                     norms.partial.begin();
+        if (norms.partial[pivot] <= threshold) {
+            stop = true;
+            break;
+        }
+
+        if (pivot != rk) {
+            for (IndexType r = 0; r < rows; ++r) {
+                std::swap(A(r, rk), A(r, pivot));
+            }
+            for (IndexType i = 0; i < done; ++i) {
+                std::swap(FT(i, rk), FT(i, pivot));
+            }
+            std::swap(norms.partial[rk], norms.partial[pivot]);
+            std::swap(norms.full[rk], norms.full[pivot]);
+            std::swap(factor.permutation[rk], factor.permutation[pivot]);
+        }
+
+        for (IndexType r = rk; r < rows; ++r) {
+            for (IndexType i = 0; i < done; ++i) {
+                A(r, rk) -= A(r, from + i) * Utils::Conj(FT(i, rk));
+            }
+        }
+
+        auto vec = A.GetSubmatrix({rk, rows}, {rk, rk + 1});
+        auto [tau, beta] = HouseholderGenerate(vec);
+        factor.tau.push_back(tau);
+
+        // F(:, done) = tau * (A^H * v - F * V^H * v) over the trailing
+        // columns, where A is not updated yet below the row rk.
+        for (IndexType i = 0; i < done; ++i) {
+            T dot = 0;
+            for (IndexType r = rk; r < rows; ++r) {
+                dot += Utils::Conj(A(r, from + i)) * A(r, rk);
+            }
+            aux[i] = -tau * dot;
+        }
+
+        auto col_tiles = (cols - rk - 1 + kTile - 1) / kTile;
+        Utils::ParallelFor(0, col_tiles, [&](std::ptrdiff_t tile) {
+            auto j_from = rk + 1 + tile * kTile;
+            auto j_to = std::min(cols, j_from + kTile);
+            auto *f_row = &FT(done, 0);
+
+            for (IndexType r = rk; r < rows; ++r) {
+                auto coeff = tau * A(r, rk);
+                const auto *row = &A(r, 0);
+                for (IndexType j = j_from; j < j_to; ++j) {
+                    f_row[j] += Utils::Conj(row[j]) * coeff;
+                }
+            }
+
+            for (IndexType i = 0; i < done; ++i) {
+                const auto *other = &FT(i, 0);
+                for (IndexType j = j_from; j < j_to; ++j) {
+                    f_row[j] += other[j] * aux[i];
+                }
+            }
+        });
+
+        for (IndexType i = 0; i <= done; ++i) {
+            auto coeff = A(rk, from + i);
+            const auto *f_row = &FT(i, 0);
+            for (IndexType j = rk + 1; j < cols; ++j) {
+                A(rk, j) -= coeff * Utils::Conj(f_row[j]);
+            }
+        }
+        A(rk, rk) = beta;
+
+        for (IndexType j = rk + 1; j < cols; ++j) {
+            if (norms.partial[j] == 0) {
+                continue;
+            }
+
+            auto ratio = std::abs(A(rk, j)) / norms.partial[j];
+            auto left = std::max(Real{0}, (1 + ratio) * (1 - ratio));
+            auto relative = norms.partial[j] / norms.full[j];
+            if (left * relative * relative <= kRecomputeBound) {
+                recompute.push_back(j);
+            } else {
+                norms.partial[j] *= std::sqrt(left);
+            }
+        }
+
+        ++done;
+        if (!recompute.empty()) {
+            break;
+        }
+    }
+
+    // A22 -= V2 * F2^H for the rows and columns after the panel.
+    auto next = from + done;
+    auto row_tiles = (rows - next + kTile - 1) / kTile;
+    Utils::ParallelFor(0, row_tiles, [&](std::ptrdiff_t tile) {
+        auto r_from = next + tile * kTile;
+        auto r_to = std::min(rows, r_from + kTile);
+
+        for (IndexType r = r_from; r < r_to; ++r) {
+            auto *row = &A(r, 0);
+            for (IndexType i = 0; i < done; ++i) {
+                auto coeff = row[from + i];
+                const auto *f_row = &FT(i, 0);
+                for (IndexType j = next; j < cols; ++j) {
+                    row[j] -= coeff * Utils::Conj(f_row[j]);
+                }
+            }
+        }
+    });
+
+    for (auto j : recompute) {
+        norms.partial[j] = ColumnNorm(A, j, next);
+        norms.full[j] = norms.partial[j];
+    }
+
+    return {done, stop};
+}
+} // namespace Details
+
+// Householder QR with column pivoting (LAPACK geqp3). The column norms are
+// downdated after each step and recomputed only when cancellation makes them
+// unreliable. The reduction stops after max_rank columns, or when all the
+// remaining column norms are not above tol times the largest initial one.
+// Columns are reduced by panels of the size block with the trailing matrix
+// updated once per panel; block = 1 gives the classic algorithm.
+template <Utils::FloatOrComplex T>
+Details::FactorPivotedQR<T>
+PivotedQR(Matrix<T> &&matrix, Utils::RealType<T> tol = 0,
+          IndexType max_rank = -1, IndexType block = Details::kQRBlockSize) {
+    using Real = Utils::RealType<T>;
+
+    static_assert(Utils::StandardFloatOrComplex<T>,
+                  "Pivoted QR for the standard floating types.");
+    assert(block > 0 && "Block size must be positive.");
+    assert(tol >= 0 && "Tolerance must be non-negative.");
+
+    auto rows = matrix.Rows();
+    auto cols = matrix.Columns();
+    auto steps = std::min(rows, cols);
+    if (max_rank >= 0) {
+        steps = std::min(steps, max_rank);
+    }
+
+    Details::FactorPivotedQR<T> factor{{std::move(matrix), {}},
+                                       std::vector<IndexType>(cols)};
+    auto &A = factor.QR;
+
+    Details::PivotNorms<Real> norms{std::vector<Real>(cols),
+                                    std::vector<Real>(cols)};
+    Real max_norm = 0;
+    for (IndexType j = 0; j < cols; ++j) {
+        factor.permutation[j] = j;
+        norms.full[j] = Details::ColumnNorm(A, j, 0);
+        max_norm = std::max(max_norm, norms.full[j]);
+    }
+    norms.partial = norms.full;
+
+    auto threshold = tol * max_norm;
+    factor.tau.reserve(steps);
+
+    IndexType rank = 0;
+    bool stop = false;
+    while (rank < steps && !stop) {
+        auto width = std::min(block, steps - rank);
+        auto [done, is_stopped] =
+            Details::ReducePivotedPanel(factor, norms, rank, width, threshold);
+        rank += done;
+        stop = is_stopped;
+    }
+
+    factor.rank = rank;
+    for (IndexType j = rank; j < cols && rank < rows; ++j) {
+        factor.residual =
+            std::max(factor.residual, Details::ColumnNorm(A, j, rank));
+    }
+
+    return factor;
+}
+
+template <MatrixUtils::MatrixType M>
+Details::FactorPivotedQR<typename M::ElemType>
+PivotedQR(const M &matrix,
+          Utils::RealType<typename M::ElemType> tol = 0,
+          IndexType max_rank = -1, IndexType block = Details::kQRBlockSize) {
+    using T = typename M::ElemType;
+
+    return PivotedQR(Matrix<T>(matrix), tol, max_rank, block);
+}
+
+// The basic solution of min ||A * X - B||: only the first rank columns of
+// A * P take part, the rest of the unknowns are zeros.
+template <Utils::FloatOrComplex T, MatrixUtils::MatrixType M>
+Matrix<T> LeastSquares(const Details::FactorPivotedQR<T> &factor,
+                       const M &rhs) {
+    assert(rhs.Rows() == factor.QR.Rows() && "Wrong number of rows.");
+
+    Matrix<T> B = rhs;
+    factor.ApplyQ(B, true);
+
+    Matrix<T> Y(factor.rank, B.Columns());
+    for (IndexType i = 0; i < factor.rank; ++i) {
+        for (IndexType j = 0; j < B.Columns(); ++j) {
+            Y(i, j) = B(i, j);
+        }
+    }
+    Details::SolveTriangular(factor.QR, Y, Details::TriangleType::Upper, false,
+                             false);
+
+    Matrix<T> X(factor.QR.Columns(), B.Columns());
+    for (IndexType i = 0; i < factor.rank; ++i) {
+        for (IndexType j = 0; j < B.Columns(); ++j) {
+            X(factor.permutation[i], j) = Y(i, j);
+        }
+    }
+
+    return X;
+}
+} // namespace LinearKit::Algorithm
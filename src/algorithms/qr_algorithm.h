@@ -1,8 +1,11 @@
 #pragma once
 
+#include "closed_form.h"
 #include "hessenberg.h"
 #include "qr_decomposition.h"
 
+#include <limits>
+
 namespace LinearKit::Algorithm {
 namespace Details {
 template <Utils::FloatOrComplex T = long double>
@@ -10,35 +13,209 @@ struct SpectralPair {
     Matrix<T> D;
     Matrix<T> U;
 };
+
+// is_converged is false if the iteration limit was reached before D became
+// diagonal (upper triangular for complex matrices).
+template <Utils::FloatOrComplex T = long double>
+struct CheckedSpectralPair {
+    Matrix<T> D;
+    Matrix<T> U;
+    bool is_converged = true;
+};
+
+// The implicit symmetric QR step with the Wilkinson shift on the block
+// [lo, hi] of the tridiagonal matrix with the diagonal d and the
+// subdiagonal e, as in Golub, Van Loan, 8.3.2. The rotations go to the
+// columns of U.
+template <Utils::Details::FloatingPoint T>
+void StepTridiagonalQR(std::vector<T> &d, std::vector<T> &e, Matrix<T> &U,
+                       IndexType lo, IndexType hi) {
+    auto pair = GetSymmetricEigen2x2(d[hi - 1], e[hi - 1], d[hi]);
+    auto shift = (std::abs(pair.first - d[hi]) < std::abs(pair.second - d[hi]))
+                     ? pair.first
+                     : pair.second;
+
+    auto x = d[lo] - shift;
+    auto z = e[lo];
+    for (IndexType k = lo; k < hi; ++k) {
+        auto r = std::hypot(x, z);
+        auto c = (r > 0) ? x / r : T{1};
+        auto s = (r > 0) ? z / r : T{0};
+        if (k > lo) {
+            e[k - 1] = r;
+        }
+
+        auto dk = d[k];
+        auto dn = d[k + 1];
+        auto ek = e[k];
+        d[k] = c * c * dk + 2 * c * s * ek + s * s * dn;
+        d[k + 1] = s * s * dk - 2 * c * s * ek + c * c * dn;
+        e[k] = c * s * (dn - dk) + (c * c - s * s) * ek;
+
+        if (k + 1 < hi) {
+            x = e[k];
+            z = s * e[k + 1];
+            e[k + 1] *= c;
+        }
+
+        for (IndexType i = 0; i < U.Rows(); ++i) {
+            auto lhs = U(i, k);
+            auto rhs = U(i, k + 1);
+            U(i, k) = c * lhs + s * rhs;
+            U(i, k + 1) = -s * lhs + c * rhs;
+        }
+    }
+}
+
+// The Hessenberg form of a real symmetric matrix is tridiagonal. The
+// trailing blocks deflate once the subdiagonal is negligible, and the 2 x 2
+// and 3 x 3 blocks are diagonalized in closed form.
+template <Utils::Details::FloatingPoint T>
+CheckedSpectralPair<T> TridiagonalQR(const Matrix<T> &H, Matrix<T> U,
+                                     std::size_t it_cnt) {
+    auto size = H.Rows();
+    std::vector<T> d(size);
+    std::vector<T> e(std::max<IndexType>(size, 1) - 1);
+    for (IndexType i = 0; i < size; ++i) {
+        d[i] = H(i, i);
+        if (i + 1 < size) {
+            e[i] = (H(i + 1, i) + H(i, i + 1)) / 2;
+        }
+    }
+
+    auto eps = std::numeric_limits<T>::epsilon();
+    auto is_negligible = [&](IndexType i) {
+        return std::abs(e[i]) <= eps * (std::abs(d[i]) + std::abs(d[i + 1]));
+    };
+
+    auto hi = size - 1;
+    auto max_steps = it_cnt * static_cast<std::size_t>(size);
+    for (std::size_t step = 0; hi > 0 && step < max_steps; ++step) {
+        if (is_negligible(hi - 1)) {
+            e[hi - 1] = 0;
+            --hi;
+            continue;
+        }
+
+        auto lo = hi - 1;
+        while (lo > 0 && !is_negligible(lo - 1)) {
+            --lo;
+        }
+
+        if (hi - lo > 2) {
+            StepTridiagonalQR(d, e, U, lo, hi);
+            continue;
+        }
+
+        if (hi - lo == 2) {
+            Matrix<T, 3, 3> block;
+            for (IndexType i = 0; i < 3; ++i) {
+                block(i, i) = d[lo + i];
+                if (i < 2) {
+                    block(i, i + 1) = block(i + 1, i) = e[lo + i];
+                }
+            }
+
+            auto [D3, U3] = GetSymmetricEigen3x3(block);
+            for (IndexType i = 0; i < 3; ++i) {
+                d[lo + i] = D3(i, i);
+            }
+            e[lo] = e[lo + 1] = 0;
+
+            for (IndexType i = 0; i < U.Rows(); ++i) {
+                T row[3] = {U(i, lo), U(i, lo + 1), U(i, hi)};
+                for (IndexType j = 0; j < 3; ++j) {
+                    U(i, lo + j) = row[0] * U3(0, j) + row[1] * U3(1, j) +
+                                   row[2] * U3(2, j);
+                }
+            }
+            hi -= 3;
+            continue;
+        }
+
+        auto pair = GetSymmetricEigen2x2(d[lo], e[lo], d[hi]);
+        d[lo] = pair.first;
+        d[hi] = pair.second;
+        e[lo] = 0;
+        for (IndexType i = 0; i < U.Rows(); ++i) {
+            auto lhs = U(i, lo);
+            auto rhs = U(i, hi);
+            U(i, lo) = pair.cos * lhs + pair.sin * rhs;
+            U(i, hi) = -pair.sin * lhs + pair.cos * rhs;
+        }
+        hi -= 2;
+    }
+
+    Matrix<T> D(size, size);
+    for (IndexType i = 0; i < size; ++i) {
+        D(i, i) = d[i];
+        if (i + 1 < size) {
+            D(i, i + 1) = e[i];
+            D(i + 1, i) = e[i];
+        }
+    }
+
+    return {std::move(D), std::move(U), hi <= 0};
+}
 } // namespace Details
 
+// Real symmetric matrices go to the tridiagonal QR with Wilkinson shifts,
+// which chooses the shifts itself: the shift argument applies to complex
+// matrices only and is ignored for real ones. Complex matrices go to the
+// shifted QR algorithm with the fixed shift.
 template <MatrixUtils::MatrixType M>
-Details::SpectralPair<typename M::ElemType>
-GetSpecDecomposition(const M &matrix,
-                     typename M::ElemType shift = typename M::ElemType{0},
-                     std::size_t it_cnt = 50) {
+Details::CheckedSpectralPair<typename M::ElemType>
+GetCheckedSpecDecomposition(
+    const M &matrix,
+    [[maybe_unused]] typename M::ElemType shift = typename M::ElemType{0},
+    std::size_t it_cnt = 50) {
     using T = typename M::ElemType;
 
     assert(MatrixUtils::IsSymmetric(matrix) &&
            "Spectral decomposition for symmetric matrices.");
 
-    auto [D, U] = GetHessenbergForm(matrix);
-    for (IndexType i = 0; i < it_cnt * D.Rows(); ++i) {
-        if constexpr (Utils::Details::IsFloatComplexT<T>::value) {
-            if (MatrixUtils::IsUpperTriangular(D))
-                break;
-        } else {
-            if (MatrixUtils::IsDiagonal(D))
-                break;
+    auto [D, U] = GetBlockedHessenbergForm(matrix);
+    if constexpr (Utils::Details::FloatingPoint<T>) {
+        static_assert(Utils::StandardFloatOrComplex<T>,
+                      "Tridiagonal QR for the standard floating types.");
+        return Details::TridiagonalQR(D, std::move(U), it_cnt);
+    } else {
+        auto is_converged = MatrixUtils::IsUpperTriangular(D);
+        for (IndexType i = 0; !is_converged && i < it_cnt * D.Rows(); ++i) {
+            auto shift_I = Matrix<T>::Identity(D.Rows()) * shift;
+            auto [Q, R] = HouseholderQR(D - shift_I);
+            D = R * Q + shift_I;
+            U *= Q;
+            is_converged = MatrixUtils::IsUpperTriangular(D);
         }
 
-        auto shift_I = Matrix<T>::Identity(D.Rows()) * shift;
-        auto [Q, R] = HouseholderQR(D - shift_I);
-        D = R * Q + shift_I;
-        U *= Q;
+        D.RoundZeroes();
+        return {std::move(D), std::move(U), is_converged};
     }
+}
 
-    D.RoundZeroes();
+// As GetCheckedSpecDecomposition, without the convergence flag.
+template <MatrixUtils::MatrixType M>
+Details::SpectralPair<typename M::ElemType>
+GetSpecDecomposition(const M &matrix,
+                     typename M::ElemType shift = typename M::ElemType{0},
+                     std::size_t it_cnt = 50) {
+    auto [D, U, is_converged] =
+        GetCheckedSpecDecomposition(matrix, shift, it_cnt);
     return {std::move(D), std::move(U)};
 }
+
+// The cyclic Jacobi method for fixed-size matrices, which needs no shift.
+// Complex matrices must be Hermitian here.
+template <Utils::FloatOrComplex T, IndexType Size>
+    requires(Size >= 0)
+Details::FixedSpectralPair<T, Size>
+GetSpecDecomposition(const Matrix<T, Size, Size> &matrix,
+                     std::size_t it_cnt = 50) {
+    assert(MatrixUtils::IsHermitian(matrix) &&
+           "Spectral decomposition for Hermitian matrices.");
+
+    return Details::FixedJacobiEigen(
+        matrix, std::min<IndexType>(it_cnt, Details::kFixedJacobiMaxSweeps));
+}
 } // namespace LinearKit::Algorithm
@@ -26,14 +26,13 @@ template <MatrixUtils::MatrixType M>
 typename M::ElemType GetBidiagThreshold(const M &matrix) {
     using T = typename M::ElemType;
 
-    long double threshold = 0;
+    Utils::RealType<T> threshold = 0;
     for (IndexType i = 0; i < matrix.Columns() - 1; ++i) {
-        long double abs_sum =
-            std::abs(matrix(i, i)) + std::abs(matrix(i, i + 1));
+        auto abs_sum = Utils::Abs(matrix(i, i)) + Utils::Abs(matrix(i, i + 1));
         threshold = std::max(threshold, abs_sum);
     }
 
-    return threshold;
+    return T{threshold};
 }
 
 template <MatrixUtils::MatrixType M>
@@ -81,6 +80,31 @@ void StepBidiagQR(M &U, M &D, M &VT) {
         GivensLeftRotation(D, i, i + 1, D(i, i), D(i + 1, i));
     }
 }
+
+// A real 2 x 2 upper triangular block is diagonalized in closed form:
+// U * [[csl, -snl], [snl, csl]] and [[csr, snr], [-snr, csr]] * VT.
+template <MatrixUtils::MutableMatrixType M>
+void DeflateBidiag2x2(M &U, M &D, M &VT) {
+    auto svd = GetTriangularSVD2x2(D(0, 0), D(0, 1), D(1, 1));
+
+    for (IndexType i = 0; i < U.Rows(); ++i) {
+        auto lhs = U(i, 0);
+        auto rhs = U(i, 1);
+        U(i, 0) = svd.csl * lhs + svd.snl * rhs;
+        U(i, 1) = -svd.snl * lhs + svd.csl * rhs;
+    }
+    for (IndexType j = 0; j < VT.Columns(); ++j) {
+        auto lhs = VT(0, j);
+        auto rhs = VT(1, j);
+        VT(0, j) = svd.csr * lhs + svd.snr * rhs;
+        VT(1, j) = -svd.snr * lhs + svd.csr * rhs;
+    }
+
+    D(0, 0) = svd.max;
+    D(0, 1) = 0;
+    D(1, 0) = 0;
+    D(1, 1) = svd.min;
+}
 } // namespace Details
 
 template <MatrixUtils::MatrixType M>
@@ -96,6 +120,13 @@ Details::DiagBasisQR<typename M::ElemType> BidiagAlgorithmQR(const M &B,
         return {std::move(U), std::move(D), std::move(VT)};
     }
 
+    if constexpr (Utils::Details::FloatingPoint<T>) {
+        if (D.Rows() == 2 && D.Columns() == 2) {
+            Details::DeflateBidiag2x2(U, D, VT);
+            return {std::move(U), std::move(D), std::move(VT)};
+        }
+    }
+
     it_cnt *= D.Columns();
     while (--it_cnt) {
         auto threshold = Details::GetBidiagThreshold(D);
@@ -106,7 +137,7 @@ Details::DiagBasisQR<typename M::ElemType> BidiagAlgorithmQR(const M &B,
         }
 
         for (IndexType i = 0; i < D.Columns() - 1; ++i) {
-            if (std::abs(D(i, i)) <= eps) {
+            if (Utils::Abs(D(i, i)) <= eps) {
                 auto [Uc, Sc, VTc] = Details::CancellationBidiagQR(D, U, i);
                 Sc.RoundZeroes(eps);
                 return {std::move(Uc), std::move(Sc), std::move(VTc * VT)};
@@ -114,7 +145,7 @@ Details::DiagBasisQR<typename M::ElemType> BidiagAlgorithmQR(const M &B,
         }
 
         for (IndexType i = 0; i < std::min(D.Rows(), D.Columns() - 1); ++i) {
-            if (std::abs(D(i, i + 1)) <= eps) {
+            if (Utils::Abs(D(i, i + 1)) <= eps) {
                 auto [U_split, S_split, VT_split] =
                     Details::SplitBidiagQR(D, i);
                 S_split.RoundZeroes();
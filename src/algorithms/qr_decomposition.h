@@ -1,9 +1,14 @@
 #pragma once
 
+#include "../matrix_utils/cast_matrix.h"
 #include "../matrix_utils/checks.h"
+#include "fixed_kernels.h"
 #include "givens.h"
 #include "householder.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace LinearKit::Algorithm {
 namespace Details {
 template <Utils::FloatOrComplex T = long double>
@@ -11,6 +16,68 @@ struct PairQR {
     Matrix<T> Q;
     Matrix<T> R;
 };
+
+inline constexpr IndexType kQRBlockSize = 32;
+
+// A = Q * R with R in the upper triangle of QR and the reflectors
+// I - tau_i * v_i * v_i^H under the diagonal, v_i(i) = 1 being implicit.
+template <Utils::FloatOrComplex T = long double>
+struct FactorQR {
+    Matrix<T> QR;
+    std::vector<T> tau;
+
+    Matrix<T> GetR() const {
+        Matrix<T> R(QR.Rows(), QR.Columns());
+        for (IndexType i = 0; i < QR.Rows(); ++i) {
+            for (IndexType j = i; j < QR.Columns(); ++j) {
+                R(i, j) = QR(i, j);
+            }
+        }
+
+        return R;
+    }
+
+    Matrix<T> GetQ(IndexType block = kQRBlockSize) const {
+        auto count = static_cast<IndexType>(tau.size());
+        return AccumulateReflectors(GetVectors(0, count), tau, 0, block);
+    }
+
+    // Explicit reflectors [from, to) starting from the row from.
+    Matrix<T> GetVectors(IndexType from, IndexType to) const {
+        Matrix<T> V(QR.Rows() - from, to - from);
+        for (IndexType k = from; k < to; ++k) {
+            V(k - from, k - from) = T{1};
+            for (IndexType r = k + 1; r < QR.Rows(); ++r) {
+                V(r - from, k - from) = QR(r, k);
+            }
+        }
+
+        return V;
+    }
+
+    // B = Q^H * B, or Q * B, for B with QR.Rows() rows.
+    template <MatrixUtils::MutableMatrixType M>
+    void ApplyQ(M &B, bool is_adjoint,
+                IndexType block = kQRBlockSize) const {
+        assert(B.Rows() == QR.Rows() && "Wrong number of rows.");
+
+        IndexType count = tau.size();
+        std::vector<IndexType> starts;
+        for (IndexType from = 0; from < count; from += block) {
+            starts.push_back(from);
+        }
+        if (!is_adjoint) {
+            std::reverse(starts.begin(), starts.end());
+        }
+
+        for (auto from : starts) {
+            auto to = std::min(count, from + block);
+            auto V = GetVectors(from, to);
+            ApplyBlockReflector(V, FormBlockReflector(V, tau, from), B, from,
+                                is_adjoint);
+        }
+    }
+};
 } // namespace Details
 
 using IndexType = LinearKit::Details::Types::IndexType;
@@ -63,6 +130,20 @@ Details::PairQR<typename M::ElemType> HouseholderQR(const M &matrix) {
     return {std::move(Q), std::move(R)};
 }
 
+template <MatrixUtils::MatrixType M>
+    requires Utils::StorageFloat<typename M::ElemType>
+Details::PairQR<Utils::WideType<typename M::ElemType>>
+HouseholderQR(const M &matrix) {
+    return HouseholderQR(MatrixUtils::WidenMatrix(matrix));
+}
+
+template <Utils::FloatOrComplex T, IndexType Rows, IndexType Cols>
+    requires(Rows >= 0 && Cols >= 0)
+Details::FixedPairQR<T, Rows, Cols>
+HouseholderQR(const Matrix<T, Rows, Cols> &matrix) {
+    return Details::FixedHouseholderQR(matrix);
+}
+
 template <MatrixUtils::MatrixType M>
 Details::PairQR<typename M::ElemType> GivensQR(const M &matrix) {
     using T = typename M::ElemType;
@@ -89,4 +170,58 @@ Details::PairQR<typename M::ElemType> GivensQR(const M &matrix) {
     R.RoundZeroes();
     return {std::move(Q), std::move(R)};
 }
+
+// Blocked Householder QR in the compact form: each panel is reduced column by
+// column, and the trailing matrix is updated by its block reflector.
+template <Utils::FloatOrComplex T>
+Details::FactorQR<T> CompactQR(Matrix<T> &&matrix,
+                               IndexType block = Details::kQRBlockSize) {
+    assert(block > 0 && "Block size must be positive.");
+
+    auto rows = matrix.Rows();
+    auto cols = matrix.Columns();
+    auto steps = std::min(rows, cols);
+
+    Details::FactorQR<T> factor{std::move(matrix), std::vector<T>(steps)};
+    auto &A = factor.QR;
+
+    for (IndexType from = 0; from < steps; from += block) {
+        auto next = std::min(steps, from + block);
+
+        for (IndexType c = from; c < next; ++c) {
+            auto vec = A.GetSubmatrix({c, rows}, {c, c + 1});
+            auto [tau, beta] = HouseholderGenerate(vec);
+            factor.tau[c] = tau;
+
+            for (IndexType j = c + 1; j < next; ++j) {
+                T sum = 0;
+                for (IndexType r = c; r < rows; ++r) {
+                    sum += Utils::Conj(A(r, c)) * A(r, j);
+                }
+
+                sum *= Utils::Conj(tau);
+                for (IndexType r = c; r < rows; ++r) {
+                    A(r, j) -= sum * A(r, c);
+                }
+            }
+
+            A(c, c) = beta;
+        }
+
+        if (next < cols) {
+            auto V = factor.GetVectors(from, next);
+            auto trailing = A.GetSubmatrix({0, rows}, {next, cols});
+            ApplyBlockReflector(V, FormBlockReflector(V, factor.tau, from),
+                                trailing, from, true);
+        }
+    }
+
+    return factor;
+}
+
+template <MatrixUtils::MatrixType M>
+Details::FactorQR<Utils::WideType<typename M::ElemType>>
+CompactQR(const M &matrix, IndexType block = Details::kQRBlockSize) {
+    return CompactQR(MatrixUtils::WidenMatrix(matrix), block);
+}
 } // namespace LinearKit::Algorithm
@@ -0,0 +1,365 @@
+#pragma once
+
+#include "qr_decomposition.h"
+
+#include <numeric>
+#include <vector>
+
+namespace LinearKit::Algorithm {
+namespace Details {
+// A rotation of the columns first and second of Q kept until Q is needed.
+template <Utils::FloatOrComplex T>
+struct PendingRotation {
+    IndexType first;
+    IndexType second;
+    GivensPair<T> rotation;
+};
+
+// The rotation of GetGivensCoefficients that skips only exact zeros, so that
+// the updates keep R triangular to the working precision.
+template <Utils::FloatOrComplex T>
+GivensPair<T> GetUpdateRotation(T first, T second) {
+    auto norm = std::sqrt(std::norm(first) + std::norm(second));
+    if (norm == 0) {
+        return {T{1}, T{0}};
+    }
+
+    return {first / norm, -second / norm};
+}
+
+// Rows f and s of A become G * (f, s) from the column from on, with
+// G = [[conj(cos), -conj(sin)], [sin, cos]] as in GivensLeftRotation.
+template <MatrixUtils::MutableMatrixType M>
+void RotateRows(M &A, IndexType f, IndexType s,
+                const GivensPair<typename M::ElemType> &rotation,
+                IndexType from = 0) {
+    auto [cos, sin] = rotation;
+
+    for (IndexType j = from; j < A.Columns(); ++j) {
+        auto first = A(f, j);
+        auto second = A(s, j);
+
+        A(f, j) = Utils::Conj(cos) * first - Utils::Conj(sin) * second;
+        A(s, j) = cos * second + sin * first;
+    }
+}
+
+// Columns f and s of Q become (f, s) * G^H, so that Q * R is kept when the
+// rows of R are rotated by G.
+template <MatrixUtils::MutableMatrixType M>
+void RotateColumnsAdjoint(M &Q, IndexType f, IndexType s,
+                          const GivensPair<typename M::ElemType> &rotation) {
+    auto [cos, sin] = rotation;
+
+    for (IndexType i = 0; i < Q.Rows(); ++i) {
+        auto first = Q(i, f);
+        auto second = Q(i, s);
+
+        Q(i, f) = cos * first - sin * second;
+        Q(i, s) = Utils::Conj(sin) * first + Utils::Conj(cos) * second;
+    }
+}
+} // namespace Details
+
+// QR factorization A = Q * R kept up to date under the changes of A by Givens
+// rotations (Golub, Van Loan, 6.5). Each update costs O(m * n) for R and
+// O(m^2) for Q instead of the refactorization.
+//
+// Without Q, only the first min(m, n) rows of R are stored: appending rows
+// and deleting columns then cost O(n^2), which is enough for streaming least
+// squares, while the other updates need Q.
+//
+// Inserted rows do not touch Q: its rows are mapped to the rows of
+// [[Q, 0], [0, I]] and the rotations are kept, so that a stream of row
+// batches builds the grown Q once, when it is next needed. GetQ builds it
+// and so is not const: the const methods do not change the object and are
+// safe to call from many threads.
+template <Utils::FloatOrComplex T>
+class UpdatableQR {
+public:
+    template <MatrixUtils::MatrixType M>
+    explicit UpdatableQR(const M &matrix, bool track_q = true)
+        : rows_(matrix.Rows()), track_q_(track_q) {
+        auto factor = CompactQR(matrix);
+        R_ = factor.GetR();
+        if (track_q_) {
+            Q_ = factor.GetQ();
+        } else {
+            TruncateR();
+        }
+    }
+
+    [[nodiscard]] IndexType Rows() const {
+        return rows_;
+    }
+
+    [[nodiscard]] IndexType Columns() const {
+        return R_.Columns();
+    }
+
+    [[nodiscard]] bool IsTrackingQ() const {
+        return track_q_;
+    }
+
+    const Matrix<T> &GetQ() {
+        assert(track_q_ && "Q is not tracked.");
+        FlushQ();
+        return Q_;
+    }
+
+    // m x n with Q, min(m, n) x n without it.
+    const Matrix<T> &GetR() const {
+        return R_;
+    }
+
+    // Inserts the rows before the row position of A.
+    template <MatrixUtils::MatrixType M>
+    void InsertRows(IndexType position, const M &rows) {
+        assert(position >= 0 && position <= rows_ && "Wrong row index.");
+        assert(rows.Columns() == Columns() && "Wrong number of columns.");
+
+        auto count = rows.Rows();
+        auto old = R_.Rows();
+        auto cols = Columns();
+
+        Matrix<T> R(old + count, cols);
+        for (IndexType i = 0; i < old; ++i) {
+            for (IndexType j = i; j < cols; ++j) {
+                R(i, j) = R_(i, j);
+            }
+        }
+        for (IndexType i = 0; i < count; ++i) {
+            for (IndexType j = 0; j < cols; ++j) {
+                R(old + i, j) = rows(i, j);
+            }
+        }
+
+        if (track_q_) {
+            // The new row i of A is the unit row old + i of the grown Q.
+            if (q_rows_.empty()) {
+                q_rows_.resize(rows_);
+                std::iota(q_rows_.begin(), q_rows_.end(), IndexType{0});
+            }
+            std::vector<IndexType> inserted(count);
+            std::iota(inserted.begin(), inserted.end(), old);
+            q_rows_.insert(q_rows_.begin() + position, inserted.begin(),
+                           inserted.end());
+        }
+
+        R_ = std::move(R);
+        rows_ += count;
+
+        for (IndexType j = 0; j < std::min(cols, old + count); ++j) {
+            for (IndexType r = std::max(j + 1, old); r < old + count; ++r) {
+                auto rotation = Details::GetUpdateRotation(R_(j, j), R_(r, j));
+                Details::RotateRows(R_, j, r, rotation, j);
+                if (track_q_) {
+                    pending_.push_back({j, r, rotation});
+                }
+            }
+        }
+
+        TruncateR();
+    }
+
+    template <MatrixUtils::MatrixType M>
+    void AppendRows(const M &rows) {
+        InsertRows(rows_, rows);
+    }
+
+    // Deletes the rows [from, from + count) of A.
+    void DeleteRows(IndexType from, IndexType count = 1) {
+        assert(track_q_ && "Deleting rows needs Q.");
+        assert(from >= 0 && count >= 0 && from + count <= rows_ &&
+               "Wrong row index.");
+        FlushQ();
+
+        for (IndexType step = 0; step < count; ++step) {
+            // Q * G^H gets the row from equal to alpha * e_1, R becomes
+            // upper Hessenberg, and the first row of it goes with the row.
+            for (IndexType i = rows_ - 2; i >= 0; --i) {
+                auto rotation = Details::GetUpdateRotation(
+                    Utils::Conj(Q_(from, i)), Utils::Conj(Q_(from, i + 1)));
+                Rotate(i, i + 1, rotation, i);
+            }
+
+            Matrix<T> Q(rows_ - 1, rows_ - 1);
+            for (IndexType i = 0; i < rows_ - 1; ++i) {
+                auto source = (i < from) ? i : i + 1;
+                for (IndexType j = 0; j < rows_ - 1; ++j) {
+                    Q(i, j) = Q_(source, j + 1);
+                }
+            }
+
+            Matrix<T> R(rows_ - 1, Columns());
+            for (IndexType i = 0; i < rows_ - 1; ++i) {
+                for (IndexType j = i; j < Columns(); ++j) {
+                    R(i, j) = R_(i + 1, j);
+                }
+            }
+
+            Q_ = std::move(Q);
+            R_ = std::move(R);
+            --rows_;
+        }
+    }
+
+    // Inserts the column before the column position of A.
+    template <MatrixUtils::MatrixType M>
+    void InsertColumn(IndexType position, const M &column) {
+        assert(track_q_ && "Inserting columns needs Q.");
+        assert(position >= 0 && position <= Columns() &&
+               "Wrong column index.");
+        assert(column.Rows() == rows_ && column.Columns() == 1 &&
+               "Wrong column size.");
+        FlushQ();
+
+        auto cols = Columns();
+        Matrix<T> R(rows_, cols + 1);
+        for (IndexType i = 0; i < rows_; ++i) {
+            for (IndexType j = 0; j < cols; ++j) {
+                R(i, j < position ? j : j + 1) = R_(i, j);
+            }
+
+            T sum = 0;
+            for (IndexType k = 0; k < rows_; ++k) {
+                sum += Utils::Conj(Q_(k, i)) * column(k, 0);
+            }
+            R(i, position) = sum;
+        }
+        R_ = std::move(R);
+
+        for (IndexType i = rows_ - 1; i > position; --i) {
+            Rotate(i - 1, i,
+                   Details::GetUpdateRotation(R_(i - 1, position),
+                                              R_(i, position)),
+                   position);
+        }
+    }
+
+    void DeleteColumn(IndexType position) {
+        assert(position >= 0 && position < Columns() && "Wrong column index.");
+        FlushQ();
+
+        auto cols = Columns();
+        Matrix<T> R(R_.Rows(), cols - 1);
+        for (IndexType i = 0; i < R_.Rows(); ++i) {
+            for (IndexType j = 0; j < cols - 1; ++j) {
+                R(i, j) = R_(i, j < position ? j : j + 1);
+            }
+        }
+        R_ = std::move(R);
+
+        for (IndexType j = position; j < std::min(cols - 1, R_.Rows() - 1);
+             ++j) {
+            Rotate(j, j + 1,
+                   Details::GetUpdateRotation(R_(j, j), R_(j + 1, j)), j);
+        }
+
+        TruncateR();
+    }
+
+    // A = A + u * v^H for the columns u and v.
+    template <MatrixUtils::MatrixType MU, MatrixUtils::MatrixType MV>
+    void RankOneUpdate(const MU &u, const MV &v) {
+        assert(track_q_ && "Rank one update needs Q.");
+        assert(u.Rows() == rows_ && u.Columns() == 1 && "Wrong size of u.");
+        assert(v.Rows() == Columns() && v.Columns() == 1 && "Wrong size of v.");
+        FlushQ();
+
+        if (rows_ == 0) {
+            return;
+        }
+
+        Matrix<T> w(rows_, 1);
+        for (IndexType i = 0; i < rows_; ++i) {
+            for (IndexType k = 0; k < rows_; ++k) {
+                w(i, 0) += Utils::Conj(Q_(k, i)) * u(k, 0);
+            }
+        }
+
+        // w becomes alpha * e_1, R becomes upper Hessenberg.
+        for (IndexType i = rows_ - 1; i > 0; --i) {
+            auto rotation = Details::GetUpdateRotation(w(i - 1, 0), w(i, 0));
+            Details::RotateRows(w, i - 1, i, rotation);
+            Rotate(i - 1, i, rotation, std::max(IndexType{0}, i - 1));
+        }
+
+        for (IndexType j = 0; j < Columns(); ++j) {
+            R_(0, j) += w(0, 0) * Utils::Conj(v(j, 0));
+        }
+
+        for (IndexType i = 0; i < std::min(rows_ - 1, Columns()); ++i) {
+            Rotate(i, i + 1,
+                   Details::GetUpdateRotation(R_(i, i), R_(i + 1, i)), i);
+        }
+    }
+
+private:
+    void Rotate(IndexType f, IndexType s,
+                const Details::GivensPair<T> &rotation, IndexType from) {
+        Details::RotateRows(R_, f, s, rotation, from);
+        if (track_q_) {
+            Details::RotateColumnsAdjoint(Q_, f, s, rotation);
+        }
+    }
+
+    // Builds the grown Q of the inserted rows and applies the kept rotations.
+    void FlushQ() {
+        if (q_rows_.empty()) {
+            return;
+        }
+
+        Matrix<T> Q(rows_, rows_);
+        for (IndexType i = 0; i < rows_; ++i) {
+            auto source = q_rows_[i];
+            if (source >= Q_.Rows()) {
+                Q(i, source) = T{1};
+                continue;
+            }
+
+            for (IndexType j = 0; j < Q_.Columns(); ++j) {
+                Q(i, j) = Q_(source, j);
+            }
+        }
+
+        for (const auto &[first, second, rotation] : pending_) {
+            Details::RotateColumnsAdjoint(Q, first, second, rotation);
+        }
+
+        Q_ = std::move(Q);
+        q_rows_.clear();
+        pending_.clear();
+    }
+
+    void TruncateR() {
+        auto size = std::min(rows_, Columns());
+        if (track_q_ || R_.Rows() == size) {
+            return;
+        }
+
+        Matrix<T> R(size, Columns());
+        for (IndexType i = 0; i < size; ++i) {
+            for (IndexType j = i; j < Columns(); ++j) {
+                R(i, j) = R_(i, j);
+            }
+        }
+        R_ = std::move(R);
+    }
+
+    IndexType rows_;
+    bool track_q_;
+    Matrix<T> Q_;
+    Matrix<T> R_;
+    // Rows of [[Q, 0], [0, I]] the rows of A map to and the rotations after
+    // them, empty when Q is up to date.
+    std::vector<IndexType> q_rows_;
+    std::vector<Details::PendingRotation<T>> pending_;
+};
+
+template <MatrixUtils::MatrixType M>
+UpdatableQR(const M &) -> UpdatableQR<typename M::ElemType>;
+
+template <MatrixUtils::MatrixType M>
+UpdatableQR(const M &, bool) -> UpdatableQR<typename M::ElemType>;
+} // namespace LinearKit::Algorithm
@@ -0,0 +1,630 @@
+#pragma once
+
+#include "hessenberg.h"
+
+#include <complex>
+#include <limits>
+#include <vector>
+
+namespace LinearKit::Algorithm {
+namespace Details {
+// is_converged is false if the Francis iteration ran out of steps: then S
+// keeps subdiagonal entries in the blocks not yet reduced, though
+// Q^T * A * Q = S still holds.
+template <Utils::FloatOrComplex T = long double>
+struct RealSchurBasis {
+    Matrix<T> S;
+    Matrix<T> Q;
+    std::vector<std::complex<T>> eigenvalues;
+    bool is_converged = true;
+};
+
+inline constexpr IndexType kFrancisMaxIterations = 30;
+// Below this size the plain double-shift iteration is faster (LAPACK nmin).
+inline constexpr IndexType kDeflationWindowMinSize = 75;
+
+template <Utils::FloatOrComplex T>
+struct PlaneRotation {
+    T cos = T{1};
+    T sin = T{0};
+};
+
+template <Utils::FloatOrComplex T>
+struct SmallReflector {
+    T v1 = T{0};
+    T v2 = T{0};
+    T tau = T{0};
+    T beta = T{0};
+};
+
+// I - tau * v * v^T with v = (1, v1, v2) maps (x, y, z) to (beta, 0, 0).
+template <Utils::FloatOrComplex T>
+SmallReflector<T> GenerateSmallReflector(T x, T y, T z) {
+    if (y == T{0} && z == T{0}) {
+        return {T{0}, T{0}, T{0}, x};
+    }
+
+    auto norm = std::hypot(x, y, z);
+    auto beta = (x >= T{0}) ? -norm : norm;
+    auto scale = T{1} / (x - beta);
+    return {y * scale, z * scale, (beta - x) / beta, beta};
+}
+
+template <Utils::FloatOrComplex T>
+void ApplySmallReflectorLeft(Matrix<T> &H, const SmallReflector<T> &refl,
+                             IndexType row, IndexType size, IndexType c_from,
+                             IndexType c_to) {
+    if (refl.tau == T{0}) {
+        return;
+    }
+
+    for (IndexType j = c_from; j < c_to; ++j) {
+        auto sum = H(row, j) + refl.v1 * H(row + 1, j);
+        if (size == 3) {
+            sum += refl.v2 * H(row + 2, j);
+        }
+
+        sum *= refl.tau;
+        H(row, j) -= sum;
+        H(row + 1, j) -= sum * refl.v1;
+        if (size == 3) {
+            H(row + 2, j) -= sum * refl.v2;
+        }
+    }
+}
+
+template <Utils::FloatOrComplex T>
+void ApplySmallReflectorRight(Matrix<T> &H, const SmallReflector<T> &refl,
+                              IndexType col, IndexType size, IndexType r_from,
+                              IndexType r_to) {
+    if (refl.tau == T{0}) {
+        return;
+    }
+
+    for (IndexType i = r_from; i < r_to; ++i) {
+        auto sum = H(i, col) + refl.v1 * H(i, col + 1);
+        if (size == 3) {
+            sum += refl.v2 * H(i, col + 2);
+        }
+
+        sum *= refl.tau;
+        H(i, col) -= sum;
+        H(i, col + 1) -= sum * refl.v1;
+        if (size == 3) {
+            H(i, col + 2) -= sum * refl.v2;
+        }
+    }
+}
+
+// Rotation [cos, -sin; sin, cos] bringing the block [a, b; c, d] to the
+// standard form: upper triangular for real eigenvalues, equal diagonal and
+// b * c < 0 for a complex pair (LAPACK lanv2).
+template <Utils::FloatOrComplex T>
+PlaneRotation<T> StandardizeBlock(T &a, T &b, T &c, T &d) {
+    auto eps = std::numeric_limits<T>::epsilon();
+    auto sign = [](T value) { return (value >= T{0}) ? T{1} : T{-1}; };
+
+    if (c == T{0}) {
+        return {};
+    }
+
+    if (b == T{0}) {
+        std::swap(a, d);
+        b = -c;
+        c = T{0};
+        return {T{0}, T{1}};
+    }
+
+    if (a - d == T{0} && sign(b) != sign(c)) {
+        return {};
+    }
+
+    auto temp = a - d;
+    auto p = temp / T{2};
+    auto bc_max = std::max(std::abs(b), std::abs(c));
+    auto bc_mis = std::min(std::abs(b), std::abs(c)) * sign(b) * sign(c);
+    auto scale = std::max(std::abs(p), bc_max);
+    auto z = p / scale * p + bc_max / scale * bc_mis;
+
+    if (z >= T{4} * eps) {
+        z = p + sign(p) * std::sqrt(scale) * std::sqrt(z);
+        a = d + z;
+        d -= bc_max / z * bc_mis;
+
+        auto tau = std::hypot(c, z);
+        b -= c;
+        PlaneRotation<T> rot{z / tau, c / tau};
+        c = T{0};
+        return rot;
+    }
+
+    auto sigma = b + c;
+    auto tau = std::hypot(sigma, temp);
+    PlaneRotation<T> rot;
+    rot.cos = std::sqrt((T{1} + std::abs(sigma) / tau) / T{2});
+    rot.sin = -(p / (tau * rot.cos)) * sign(sigma);
+
+    auto aa = a * rot.cos + b * rot.sin;
+    auto bb = -a * rot.sin + b * rot.cos;
+    auto cc = c * rot.cos + d * rot.sin;
+    auto dd = -c * rot.sin + d * rot.cos;
+
+    a = aa * rot.cos + cc * rot.sin;
+    b = bb * rot.cos + dd * rot.sin;
+    c = -aa * rot.sin + cc * rot.cos;
+    d = -bb * rot.sin + dd * rot.cos;
+
+    temp = (a + d) / T{2};
+    a = d = temp;
+
+    if (c != T{0}) {
+        if (b == T{0}) {
+            b = -c;
+            c = T{0};
+            rot = {-rot.sin, rot.cos};
+        } else if (sign(b) == sign(c)) {
+            auto sab = std::sqrt(std::abs(b));
+            auto sac = std::sqrt(std::abs(c));
+            auto shift = sign(c) * sab * sac;
+            auto scale_inv = T{1} / std::sqrt(std::abs(b + c));
+
+            a = temp + shift;
+            d = temp - shift;
+            b -= c;
+            c = T{0};
+
+            auto cos = sab * scale_inv;
+            auto sin = sac * scale_inv;
+            rot = {rot.cos * cos - rot.sin * sin,
+                   rot.cos * sin + rot.sin * cos};
+        }
+    }
+
+    return rot;
+}
+
+template <Utils::FloatOrComplex T>
+void StandardizeBlockAt(Matrix<T> &H, Matrix<T> &Z, IndexType k) {
+    auto rot = StandardizeBlock(H(k, k), H(k, k + 1), H(k + 1, k),
+                                H(k + 1, k + 1));
+
+    auto rotate = [&](T &first, T &second) {
+        auto lhs = first;
+        auto rhs = second;
+        first = rot.cos * lhs + rot.sin * rhs;
+        second = rot.cos * rhs - rot.sin * lhs;
+    };
+
+    for (IndexType j = k + 2; j < H.Columns(); ++j) {
+        rotate(H(k, j), H(k + 1, j));
+    }
+    for (IndexType i = 0; i < k; ++i) {
+        rotate(H(i, k), H(i, k + 1));
+    }
+    for (IndexType i = 0; i < Z.Rows(); ++i) {
+        rotate(Z(i, k), Z(i, k + 1));
+    }
+}
+
+// Largest k in (lo, hi] with negligible H(k, k - 1), or lo.
+template <Utils::FloatOrComplex T>
+IndexType FindSmallSubdiagonal(const Matrix<T> &H, IndexType lo,
+                               IndexType hi) {
+    auto eps = std::numeric_limits<T>::epsilon();
+    auto safe_min = std::numeric_limits<T>::min() *
+                    (static_cast<T>(H.Rows()) / eps);
+
+    for (IndexType k = hi; k > lo; --k) {
+        auto sub = std::abs(H(k, k - 1));
+        if (sub <= safe_min) {
+            return k;
+        }
+
+        auto scale = std::abs(H(k - 1, k - 1)) + std::abs(H(k, k));
+        if (scale == T{0}) {
+            if (k - 2 >= lo) {
+                scale += std::abs(H(k - 1, k - 2));
+            }
+            if (k + 1 <= hi) {
+                scale += std::abs(H(k + 1, k));
+            }
+        }
+
+        if (sub <= eps * scale) {
+            return k;
+        }
+    }
+
+    return lo;
+}
+
+// One implicit double-shift step on the unreduced block [lo, hi], chasing
+// the bulge by 3x3 reflectors applied to the whole matrix.
+template <Utils::FloatOrComplex T>
+void FrancisStep(Matrix<T> &H, Matrix<T> &Z, IndexType lo, IndexType hi,
+                 IndexType iteration) {
+    auto size = H.Rows();
+
+    T s;
+    T t;
+    if (iteration > 0 && iteration % 10 == 0) {
+        // Exceptional shift against cycling.
+        auto x = std::abs(H(hi, hi - 1)) + std::abs(H(hi - 1, hi - 2));
+        s = T{3} / T{2} * x;
+        t = x * x;
+    } else {
+        s = H(hi - 1, hi - 1) + H(hi, hi);
+        t = H(hi - 1, hi - 1) * H(hi, hi) - H(hi - 1, hi) * H(hi, hi - 1);
+    }
+
+    auto x = H(lo, lo) * H(lo, lo) + H(lo, lo + 1) * H(lo + 1, lo) -
+             s * H(lo, lo) + t;
+    auto y = H(lo + 1, lo) * (H(lo, lo) + H(lo + 1, lo + 1) - s);
+    auto z = H(lo + 1, lo) * H(lo + 2, lo + 1);
+
+    for (IndexType k = lo; k < hi; ++k) {
+        IndexType length = std::min(IndexType{3}, hi - k + 1);
+        auto refl = GenerateSmallReflector(x, y, length == 3 ? z : T{0});
+
+        if (k > lo) {
+            H(k, k - 1) = refl.beta;
+            H(k + 1, k - 1) = T{0};
+            if (length == 3) {
+                H(k + 2, k - 1) = T{0};
+            }
+        }
+
+        ApplySmallReflectorLeft(H, refl, k, length, k, size);
+        ApplySmallReflectorRight(H, refl, k, length, 0,
+                                 std::min(k + 4, hi + 1));
+        ApplySmallReflectorRight(Z, refl, k, length, 0, Z.Rows());
+
+        x = H(k + 1, k);
+        y = (k + 2 <= hi) ? H(k + 2, k) : T{0};
+        z = (k + 3 <= hi) ? H(k + 3, k) : T{0};
+    }
+}
+
+template <Utils::FloatOrComplex T>
+bool FrancisSchur(Matrix<T> &H, Matrix<T> &Z, bool use_deflation_window,
+                  IndexType max_iterations = kFrancisMaxIterations);
+
+// Aggressive early deflation: the bottom window is brought to the Schur form,
+// and the eigenvalues whose spike entries are negligible are deflated at once.
+// The rest of the window is returned to the Hessenberg form.
+template <Utils::FloatOrComplex T>
+IndexType DeflateWindow(Matrix<T> &H, Matrix<T> &Z, IndexType lo,
+                        IndexType hi) {
+    auto eps = std::numeric_limits<T>::epsilon();
+    auto size = H.Rows();
+    auto active = hi - lo + 1;
+    auto window = std::min(active - 1, std::max(IndexType{6}, active / 32));
+    auto top = hi - window + 1;
+    auto spike = H(top, top - 1);
+
+    Matrix<T> W = H.GetSubmatrix({top, hi + 1}, {top, hi + 1});
+    Matrix<T> V = Matrix<T>::Identity(window);
+    if (!FrancisSchur(W, V, false)) {
+        return 0;
+    }
+
+    IndexType kept = window;
+    while (kept > 0) {
+        auto k = kept - 1;
+        bool is_pair = k > 0 && W(k, k - 1) != T{0};
+
+        T scale = std::abs(W(k, k));
+        T spike_part = std::abs(spike * V(0, k));
+        if (is_pair) {
+            scale += std::sqrt(std::abs(W(k, k - 1))) *
+                     std::sqrt(std::abs(W(k - 1, k)));
+            spike_part += std::abs(spike * V(0, k - 1));
+        }
+
+        if (scale == T{0}) {
+            scale = std::abs(spike);
+        }
+        if (spike_part > eps * scale) {
+            break;
+        }
+
+        kept -= is_pair ? 2 : 1;
+    }
+
+    if (kept == window) {
+        return 0;
+    }
+
+    for (IndexType i = 0; i < window; ++i) {
+        for (IndexType j = 0; j < window; ++j) {
+            H(top + i, top + j) = W(i, j);
+        }
+        H(top + i, top - 1) = (i < kept) ? spike * V(0, i) : T{0};
+    }
+
+    std::vector<T> buffer(window);
+    for (IndexType j = hi + 1; j < size; ++j) {
+        for (IndexType i = 0; i < window; ++i) {
+            buffer[i] = T{0};
+            for (IndexType k = 0; k < window; ++k) {
+                buffer[i] += V(k, i) * H(top + k, j);
+            }
+        }
+        for (IndexType i = 0; i < window; ++i) {
+            H(top + i, j) = buffer[i];
+        }
+    }
+
+    auto apply_right = [&](Matrix<T> &A, IndexType rows) {
+        for (IndexType r = 0; r < rows; ++r) {
+            for (IndexType j = 0; j < window; ++j) {
+                buffer[j] = T{0};
+                for (IndexType k = 0; k < window; ++k) {
+                    buffer[j] += A(r, top + k) * V(k, j);
+                }
+            }
+            for (IndexType j = 0; j < window; ++j) {
+                A(r, top + j) = buffer[j];
+            }
+        }
+    };
+    apply_right(H, top);
+    apply_right(Z, Z.Rows());
+
+    auto bottom = top + kept;
+    for (IndexType c = top - 1; c + 2 < bottom; ++c) {
+        Matrix<T> vec = H.GetSubmatrix({c + 1, bottom}, {c, c + 1});
+        auto [tau, beta] = HouseholderGenerate(vec);
+
+        H(c + 1, c) = beta;
+        for (IndexType r = c + 2; r < bottom; ++r) {
+            H(r, c) = T{0};
+        }
+
+        if (tau == T{0}) {
+            continue;
+        }
+
+        for (IndexType j = c + 1; j < size; ++j) {
+            T sum = 0;
+            for (IndexType r = 0; r < vec.Rows(); ++r) {
+                sum += vec(r, 0) * H(c + 1 + r, j);
+            }
+            sum *= tau;
+            for (IndexType r = 0; r < vec.Rows(); ++r) {
+                H(c + 1 + r, j) -= sum * vec(r, 0);
+            }
+        }
+
+        auto reflect_right = [&](Matrix<T> &A, IndexType rows) {
+            for (IndexType i = 0; i < rows; ++i) {
+                T sum = 0;
+                for (IndexType r = 0; r < vec.Rows(); ++r) {
+                    sum += A(i, c + 1 + r) * vec(r, 0);
+                }
+                sum *= tau;
+                for (IndexType r = 0; r < vec.Rows(); ++r) {
+                    A(i, c + 1 + r) -= sum * vec(r, 0);
+                }
+            }
+        };
+        reflect_right(H, bottom);
+        reflect_right(Z, Z.Rows());
+    }
+
+    return window - kept;
+}
+
+// Brings the Hessenberg matrix H to the real Schur form, accumulating the
+// transformations into the columns of Z. Returns false if more than
+// max_iterations steps per eigenvalue are needed.
+template <Utils::FloatOrComplex T>
+bool FrancisSchur(Matrix<T> &H, Matrix<T> &Z, bool use_deflation_window,
+                  IndexType max_iterations) {
+    auto size = H.Rows();
+    auto max_total = max_iterations * std::max(size, IndexType{10});
+
+    IndexType total = 0;
+    IndexType iteration = 0;
+    IndexType hi = size - 1;
+
+    while (hi >= 0) {
+        auto lo = FindSmallSubdiagonal(H, IndexType{0}, hi);
+        if (lo > 0) {
+            H(lo, lo - 1) = T{0};
+        }
+
+        if (lo == hi) {
+            --hi;
+            iteration = 0;
+            continue;
+        }
+
+        if (lo + 1 == hi) {
+            StandardizeBlockAt(H, Z, lo);
+            hi -= 2;
+            iteration = 0;
+            continue;
+        }
+
+        if (++total > max_total) {
+            return false;
+        }
+
+        if (use_deflation_window && hi - lo + 1 >= kDeflationWindowMinSize &&
+            DeflateWindow(H, Z, lo, hi) > 0) {
+            iteration = 0;
+            continue;
+        }
+
+        FrancisStep(H, Z, lo, hi, ++iteration);
+    }
+
+    for (IndexType i = 2; i < size; ++i) {
+        for (IndexType j = 0; j + 1 < i; ++j) {
+            H(i, j) = T{0};
+        }
+    }
+
+    return true;
+}
+
+template <Utils::FloatOrComplex T>
+std::vector<std::complex<T>> GetSchurEigenvalues(const Matrix<T> &S) {
+    std::vector<std::complex<T>> eigenvalues;
+    eigenvalues.reserve(S.Rows());
+
+    for (IndexType i = 0; i < S.Rows(); ++i) {
+        if (i + 1 < S.Rows() && S(i + 1, i) != T{0}) {
+            auto im = std::sqrt(std::abs(S(i, i + 1))) *
+                      std::sqrt(std::abs(S(i + 1, i)));
+            eigenvalues.emplace_back(S(i, i), im);
+            eigenvalues.emplace_back(S(i + 1, i + 1), -im);
+            ++i;
+        } else {
+            eigenvalues.emplace_back(S(i, i), T{0});
+        }
+    }
+
+    return eigenvalues;
+}
+
+// Solves the rows [0, last) of (S - lambda) x = 0 for the given x[last:].
+// Tiny pivots are replaced by small to keep the solution finite.
+template <Utils::FloatOrComplex T, typename Scalar>
+void QuasiTriangularBackSolve(const Matrix<T> &S, std::vector<Scalar> &x,
+                              IndexType last, Scalar lambda, T small) {
+    auto residual = [&](IndexType row, IndexType from) {
+        Scalar sum{0};
+        for (IndexType m = from; m < static_cast<IndexType>(x.size()); ++m) {
+            sum -= S(row, m) * x[m];
+        }
+        return sum;
+    };
+    auto pivot = [&](Scalar value) {
+        return (std::abs(value) < small) ? Scalar{small} : value;
+    };
+
+    for (IndexType j = last - 1; j >= 0; --j) {
+        if (j > 0 && S(j, j - 1) != T{0}) {
+            auto a11 = S(j - 1, j - 1) - lambda;
+            auto a12 = Scalar{S(j - 1, j)};
+            auto a21 = Scalar{S(j, j - 1)};
+            auto a22 = S(j, j) - lambda;
+            auto r1 = residual(j - 1, j + 1);
+            auto r2 = residual(j, j + 1);
+
+            auto det = pivot(a11 * a22 - a12 * a21);
+            x[j - 1] = (r1 * a22 - a12 * r2) / det;
+            x[j] = (a11 * r2 - a21 * r1) / det;
+            --j;
+        } else {
+            x[j] = residual(j, j + 1) / pivot(S(j, j) - lambda);
+        }
+    }
+}
+} // namespace Details
+
+// A = Q * S * Q^T. max_iterations bounds the Francis steps per eigenvalue;
+// if it is exceeded, the result has is_converged == false.
+template <MatrixUtils::MatrixType M>
+Details::RealSchurBasis<typename M::ElemType>
+GetRealSchurForm(const M &matrix,
+                 IndexType max_iterations = Details::kFrancisMaxIterations) {
+    using T = typename M::ElemType;
+
+    static_assert(!Utils::Details::IsFloatComplexT<T>::value,
+                  "Real Schur form for real matrices.");
+    static_assert(Utils::StandardFloatOrComplex<T>,
+                  "Real Schur form for the standard floating types.");
+    assert(MatrixUtils::IsSquare(matrix) &&
+           "Real Schur form for square matrices.");
+
+    auto reduction = ReduceToHessenberg(matrix);
+    auto Q = reduction.GetQ();
+    auto S = std::move(reduction.H);
+
+    auto is_converged = Details::FrancisSchur(S, Q, true, max_iterations);
+
+    auto eigenvalues = Details::GetSchurEigenvalues(S);
+    return {std::move(S), std::move(Q), std::move(eigenvalues), is_converged};
+}
+
+// Right eigenvectors by back-substitution on the Schur form, normalized to
+// the unit length. For a complex pair at columns (k, k + 1) the real and the
+// imaginary parts of the vector of the eigenvalue with the positive imaginary
+// part are stored in the columns k and k + 1.
+template <Utils::FloatOrComplex T>
+Matrix<T> GetRealEigenvectors(const Details::RealSchurBasis<T> &schur) {
+    using Complex = std::complex<T>;
+
+    const auto &[S, Q, eigenvalues, is_converged] = schur;
+    assert(is_converged && "Eigenvectors of a converged Schur form.");
+    auto size = S.Rows();
+
+    T norm = 0;
+    S.ForEach([&](const T &val) { norm = std::max(norm, std::abs(val)); });
+    auto small = std::max(std::numeric_limits<T>::epsilon() * norm,
+                          std::numeric_limits<T>::min());
+
+    Matrix<T> X(size, size);
+
+    for (IndexType k = 0; k < size; ++k) {
+        if (eigenvalues[k].imag() == T{0}) {
+            std::vector<T> x(k + 1, T{0});
+            x[k] = T{1};
+            Details::QuasiTriangularBackSolve(S, x, k, eigenvalues[k].real(),
+                                              small);
+
+            T length = 0;
+            for (IndexType i = 0; i < size; ++i) {
+                for (IndexType m = 0; m <= k; ++m) {
+                    X(i, k) += Q(i, m) * x[m];
+                }
+                length += X(i, k) * X(i, k);
+            }
+
+            length = std::sqrt(length);
+            for (IndexType i = 0; i < size; ++i) {
+                X(i, k) /= length;
+            }
+            continue;
+        }
+
+        // Eigenvector of the standardized block [a, b; c, a] for a + i * w.
+        auto b = S(k, k + 1);
+        auto c = S(k + 1, k);
+        auto w = eigenvalues[k].imag();
+
+        std::vector<Complex> x(k + 2, Complex{0});
+        if (std::abs(b) >= std::abs(c)) {
+            x[k] = Complex{1};
+            x[k + 1] = Complex{0, w / b};
+        } else {
+            x[k] = Complex{0, w / c};
+            x[k + 1] = Complex{1};
+        }
+        Details::QuasiTriangularBackSolve(S, x, k, eigenvalues[k], small);
+
+        T length = 0;
+        for (IndexType i = 0; i < size; ++i) {
+            Complex sum{0};
+            for (IndexType m = 0; m <= k + 1; ++m) {
+                sum += Q(i, m) * x[m];
+            }
+            X(i, k) = sum.real();
+            X(i, k + 1) = sum.imag();
+            length += std::norm(sum);
+        }
+
+        length = std::sqrt(length);
+        for (IndexType i = 0; i < size; ++i) {
+            X(i, k) /= length;
+            X(i, k + 1) /= length;
+        }
+        ++k;
+    }
+
+    return X;
+}
+} // namespace LinearKit::Algorithm
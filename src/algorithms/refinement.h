@@ -0,0 +1,158 @@
+#pragma once
+
+#include "../matrix_utils/cast_matrix.h"
+#include "solve.h"
+
+#include <limits>
+
+namespace LinearKit::Algorithm {
+enum class RefinementFactor { LU, QR };
+
+namespace Details {
+inline constexpr IndexType kRefinementMaxSteps = 30;
+
+// The correction is accepted while the residual shrinks at least by this
+// factor at each step.
+inline constexpr long double kRefinementMinDecrease = 0.5;
+
+// X solves A * X = B. steps is the number of refinement steps done, also
+// when is_refined is false: then the refinement stagnated after them and the
+// low-precision factorization was replaced by the full one.
+template <Utils::FloatOrComplex T = long double>
+struct RefinedSolution {
+    Matrix<T> X;
+    IndexType steps = 0;
+    bool is_refined = true;
+};
+
+template <MatrixUtils::MatrixType M>
+typename M::ElemType GetMaxAbsRowSum(const M &matrix) {
+    using T = typename M::ElemType;
+
+    T result = 0;
+    for (IndexType i = 0; i < matrix.Rows(); ++i) {
+        T sum = 0;
+        for (IndexType j = 0; j < matrix.Columns(); ++j) {
+            sum += std::abs(matrix(i, j));
+        }
+        result = std::max(result, sum);
+    }
+    return result;
+}
+
+// B - A * X, without rounding small entries to zero as operator* does.
+template <MatrixUtils::MatrixType M, MatrixUtils::MatrixType R>
+Matrix<typename M::ElemType> GetResidual(const M &A,
+                                         const Matrix<typename M::ElemType> &X,
+                                         const R &B) {
+    using T = typename M::ElemType;
+
+    Matrix<T> residual = B;
+    Utils::ParallelFor(0, A.Rows(), [&](std::ptrdiff_t i) {
+        for (IndexType k = 0; k < A.Columns(); ++k) {
+            auto coeff = A(i, k);
+            for (IndexType j = 0; j < X.Columns(); ++j) {
+                residual(i, j) -= coeff * X(k, j);
+            }
+        }
+    });
+    return residual;
+}
+
+// Iterative refinement with the low-precision factor: X += A^-1 * (B - A * X)
+// with the residual and X kept in the precision of A. Converged when
+// ||B - A * X|| <= sqrt(n) * eps * ||A|| * ||X|| in the max norms, as in
+// LAPACK dsgesv. is_refined is false if the residual stagnates.
+template <Utils::FloatOrComplex Low, typename Factor, MatrixUtils::MatrixType M,
+          MatrixUtils::MatrixType R>
+RefinedSolution<typename M::ElemType>
+Refine(const Factor &factor, const M &A, const R &B, IndexType max_steps) {
+    using T = typename M::ElemType;
+
+    auto low_solve = [&](const auto &rhs) {
+        auto low = MatrixUtils::CastMatrix<Low>(rhs);
+        SolveInPlace(factor, low);
+        return MatrixUtils::CastMatrix<T>(low);
+    };
+
+    auto tolerance = std::sqrt(static_cast<T>(A.Rows())) *
+                     std::numeric_limits<T>::epsilon() * GetMaxAbsRowSum(A);
+
+    RefinedSolution<T> solution{low_solve(B)};
+    auto last_norm = std::numeric_limits<T>::infinity();
+
+    for (;; ++solution.steps) {
+        auto residual = GetResidual(A, solution.X, B);
+
+        auto residual_norm = T{0};
+        auto solution_norm = T{0};
+        residual.ForEach([&](const T &value) {
+            residual_norm = std::max(residual_norm, std::abs(value));
+        });
+        solution.X.ForEach([&](const T &value) {
+            solution_norm = std::max(solution_norm, std::abs(value));
+        });
+
+        if (residual_norm <= tolerance * solution_norm) {
+            return solution;
+        }
+
+        // Also catches NaN from a singular low-precision factor.
+        if (solution.steps == max_steps ||
+            !(residual_norm <= kRefinementMinDecrease * last_norm)) {
+            solution.is_refined = false;
+            return solution;
+        }
+        last_norm = residual_norm;
+
+        auto correction = low_solve(residual);
+        solution.X.ApplyForEach(
+            [&](T &value, auto i, auto j) { value += correction(i, j); });
+    }
+}
+} // namespace Details
+
+// Solves A * X = B for square A: A is factored in Low, typically twice as
+// fast, and the solution is refined to the precision of A. If A does not fit
+// into Low, its low-precision factor is singular or the refinement stagnates,
+// A is factored in its own precision.
+template <Utils::Details::FloatingPoint Low = float, MatrixUtils::MatrixType M,
+          MatrixUtils::MatrixType R>
+    requires std::is_floating_point_v<typename M::ElemType>
+Details::RefinedSolution<typename M::ElemType>
+RefinedSolve(const M &A, const R &B,
+             RefinementFactor factorization = RefinementFactor::LU,
+             IndexType max_steps = Details::kRefinementMaxSteps) {
+    using T = typename M::ElemType;
+
+    assert(A.Rows() == A.Columns() && "Solve for square matrices.");
+    assert(B.Rows() == A.Rows() && "Wrong number of rows.");
+
+    auto fits = Details::GetMaxAbsRowSum(A) <=
+                static_cast<T>(std::numeric_limits<Low>::max());
+
+    IndexType steps = 0;
+    if (fits && factorization == RefinementFactor::LU) {
+        auto factor = LU(MatrixUtils::CastMatrix<Low>(A));
+        if (!factor.IsSingular()) {
+            auto solution = Details::Refine<Low>(factor, A, B, max_steps);
+            if (solution.is_refined) {
+                return solution;
+            }
+            steps = solution.steps;
+        }
+    } else if (fits) {
+        auto factor = CompactQR(MatrixUtils::CastMatrix<Low>(A));
+        auto solution = Details::Refine<Low>(factor, A, B, max_steps);
+        if (solution.is_refined) {
+            return solution;
+        }
+        steps = solution.steps;
+    }
+
+    Matrix<T> X = (factorization == RefinementFactor::LU)
+                      ? Solve(LU(A), B)
+                      : Solve(CompactQR(A), B);
+    return {std::move(X), steps, false};
+}
+} // namespace LinearKit::Algorithm
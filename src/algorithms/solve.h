@@ -0,0 +1,186 @@
+#pragma once
+
+#include "cholesky.h"
+#include "lu.h"
+#include "qr_decomposition.h"
+
+namespace LinearKit::Algorithm {
+namespace Details {
+inline constexpr IndexType kSolveBlockSize = 64;
+inline constexpr IndexType kSolveTileSize = 64;
+
+enum class TriangleType { Lower, Upper };
+
+// Solves op(A) * X = B in place for the leading triangle of A of the size
+// B.Rows(), op(A) = A or A^H. Rows go by blocks: the solved rows update the
+// next block as a product, then the block is solved by substitution. Column
+// tiles of B are independent and are solved on the thread pool.
+template <Utils::FloatOrComplex T, MatrixUtils::MutableMatrixType M>
+void SolveTriangular(const Matrix<T> &A, M &B, TriangleType type,
+                     bool is_unit, bool is_adjoint) {
+    auto size = B.Rows();
+    auto is_lower = (type == TriangleType::Lower) != is_adjoint;
+    auto coeff = [&](IndexType i, IndexType j) {
+        return is_adjoint ? Utils::Conj(A(j, i)) : A(i, j);
+    };
+
+    auto col_tiles = (B.Columns() + kSolveTileSize - 1) / kSolveTileSize;
+
+    Utils::ParallelFor(0, col_tiles, [&](std::ptrdiff_t tile) {
+        auto j_from = tile * kSolveTileSize;
+        auto j_to = std::min(B.Columns(), j_from + kSolveTileSize);
+
+        auto eliminate = [&](IndexType i, IndexType k) {
+            auto c = coeff(i, k);
+            if (c == T{0}) {
+                return;
+            }
+            for (IndexType j = j_from; j < j_to; ++j) {
+                B(i, j) -= c * B(k, j);
+            }
+        };
+        auto divide = [&](IndexType i) {
+            if (is_unit) {
+                return;
+            }
+            auto inverse = T{1} / coeff(i, i);
+            for (IndexType j = j_from; j < j_to; ++j) {
+                B(i, j) *= inverse;
+            }
+        };
+
+        if (is_lower) {
+            for (IndexType from = 0; from < size; from += kSolveBlockSize) {
+                auto to = std::min(size, from + kSolveBlockSize);
+
+                for (IndexType k = 0; k < from; ++k) {
+                    for (IndexType i = from; i < to; ++i) {
+                        eliminate(i, k);
+                    }
+                }
+
+                for (IndexType i = from; i < to; ++i) {
+                    for (IndexType k = from; k < i; ++k) {
+                        eliminate(i, k);
+                    }
+                    divide(i);
+                }
+            }
+        } else {
+            for (IndexType to = size; to > 0; to -= kSolveBlockSize) {
+                auto from = std::max(IndexType{0}, to - kSolveBlockSize);
+
+                for (IndexType k = to; k < size; ++k) {
+                    for (IndexType i = from; i < to; ++i) {
+                        eliminate(i, k);
+                    }
+                }
+
+                for (IndexType i = to - 1; i >= from; --i) {
+                    for (IndexType k = i + 1; k < to; ++k) {
+                        eliminate(i, k);
+                    }
+                    divide(i);
+                }
+            }
+        }
+    });
+}
+} // namespace Details
+
+// A * X = B in place for every column of B.
+template <Utils::FloatOrComplex T, MatrixUtils::MutableMatrixType M>
+void SolveInPlace(const Details::FactorLU<T> &factor, M &rhs) {
+    assert(factor.LU.Rows() == factor.LU.Columns() &&
+           "Solve for square matrices.");
+    assert(rhs.Rows() == factor.LU.Rows() && "Wrong number of rows.");
+    assert(!factor.IsSingular() && "Solve for nonsingular matrices.");
+
+    for (IndexType i = 0; i < static_cast<IndexType>(factor.pivots.size());
+         ++i) {
+        if (factor.pivots[i] != i) {
+            for (IndexType j = 0; j < rhs.Columns(); ++j) {
+                std::swap(rhs(i, j), rhs(factor.pivots[i], j));
+            }
+        }
+    }
+
+    Details::SolveTriangular(factor.LU, rhs, Details::TriangleType::Lower,
+                             true, false);
+    Details::SolveTriangular(factor.LU, rhs, Details::TriangleType::Upper,
+                             false, false);
+}
+
+template <Utils::FloatOrComplex T, MatrixUtils::MutableMatrixType M>
+void SolveInPlace(const Details::FactorCholesky<T> &factor, M &rhs) {
+    assert(rhs.Rows() == factor.L.Rows() && "Wrong number of rows.");
+    assert(factor.IsPositiveDefinite() &&
+           "Solve for positive definite matrices.");
+
+    Details::SolveTriangular(factor.L, rhs, Details::TriangleType::Lower,
+                             false, false);
+    Details::SolveTriangular(factor.L, rhs, Details::TriangleType::Lower,
+                             false, true);
+}
+
+template <Utils::FloatOrComplex T, MatrixUtils::MutableMatrixType M>
+void SolveInPlace(const Details::FactorQR<T> &factor, M &rhs) {
+    assert(factor.QR.Rows() == factor.QR.Columns() &&
+           "Solve for square matrices.");
+    assert(rhs.Rows() == factor.QR.Rows() && "Wrong number of rows.");
+
+    factor.ApplyQ(rhs, true);
+    Details::SolveTriangular(factor.QR, rhs, Details::TriangleType::Upper,
+                             false, false);
+}
+
+template <typename Factor, MatrixUtils::MatrixType M>
+Matrix<typename M::ElemType> Solve(const Factor &factor, const M &rhs) {
+    Matrix<typename M::ElemType> result = rhs;
+    SolveInPlace(factor, result);
+    return result;
+}
+
+// min ||A * X - B|| for A with full column rank, given its QR factorization.
+template <Utils::FloatOrComplex T, MatrixUtils::MatrixType M>
+Matrix<T> LeastSquares(const Details::FactorQR<T> &factor, const M &rhs) {
+    auto cols = factor.QR.Columns();
+
+    assert(factor.QR.Rows() >= cols &&
+           "Least squares for matrices with rows >= columns.");
+    assert(rhs.Rows() == factor.QR.Rows() && "Wrong number of rows.");
+
+    Matrix<T> B = rhs;
+    factor.ApplyQ(B, true);
+
+    Matrix<T> X = B.GetSubmatrix({0, cols}, {0, B.Columns()});
+    Details::SolveTriangular(factor.QR, X, Details::TriangleType::Upper,
+                             false, false);
+    return X;
+}
+
+// The solution of A * X = B with the least norm for A with full row rank,
+// given the QR factorization of A^H.
+template <Utils::FloatOrComplex T, MatrixUtils::MatrixType M>
+Matrix<T> MinNorm(const Details::FactorQR<T> &adjoint_factor, const M &rhs) {
+    auto rows = adjoint_factor.QR.Columns();
+    auto cols = adjoint_factor.QR.Rows();
+
+    assert(rows <= cols && "Min norm for matrices with rows <= columns.");
+    assert(rhs.Rows() == rows && "Wrong number of rows.");
+
+    Matrix<T> Y = rhs;
+    Details::SolveTriangular(adjoint_factor.QR, Y, Details::TriangleType::Upper,
+                             false, true);
+
+    Matrix<T> X(cols, Y.Columns());
+    for (IndexType i = 0; i < rows; ++i) {
+        for (IndexType j = 0; j < Y.Columns(); ++j) {
+            X(i, j) = Y(i, j);
+        }
+    }
+
+    adjoint_factor.ApplyQ(X, false);
+    return X;
+}
+} // namespace LinearKit::Algorithm
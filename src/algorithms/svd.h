@@ -1,17 +1,34 @@
 #pragma once
 
 #include "../matrix_utils/cast_matrix.h"
+#include "bidiag_divide_conquer.h"
 #include "bidiagonalization.h"
+#include "jacobi_svd.h"
 #include "qr_algorithm_bidiag.h"
 
 namespace LinearKit::Algorithm {
+enum class SVDEngine { Auto, BidiagQR, Jacobi, DivideAndConquer };
+
 namespace Details {
-template <Utils::FloatOrComplex T>
-struct SingularBasis {
-    Matrix<T> U;
-    Matrix<T> S;
-    Matrix<T> VT;
-};
+// SVDEngine::Auto by min(rows, cols): below kJacobiMinSize the bidiagonal QR
+// algorithm, from kJacobiMinSize to kJacobiMaxSize the one-sided Jacobi
+// method, above it divide and conquer. A Jacobi run that stops at its sweep
+// limit is redone by the bidiagonal QR algorithm.
+inline constexpr IndexType kJacobiMinSize = 32;
+inline constexpr IndexType kJacobiMaxSize = 512;
+
+inline SVDEngine SelectSVDEngine(IndexType rows, IndexType cols) {
+    auto size = std::min(rows, cols);
+    if (size > kJacobiMaxSize) {
+        return SVDEngine::DivideAndConquer;
+    }
+
+    if (size >= kJacobiMinSize) {
+        return SVDEngine::Jacobi;
+    }
+
+    return SVDEngine::BidiagQR;
+}
 
 template <MatrixUtils::MutableMatrixType M>
 void ToPositiveSingular(M &S, M &VT) {
@@ -66,20 +83,51 @@ void SortSingular(M &U, M &S, M &VT) {
 }
 } // namespace Details
 
-template <MatrixUtils::MatrixType M>
-Details::SingularBasis<typename M::ElemType> SVD(const M &matrix) {
+// Compute is the precision of the bidiagonal stage. The extended types such
+// as DoubleDouble go to the bidiagonal QR algorithm, the only engine built on
+// the Utils math functions.
+template <Utils::Details::FloatingPoint Compute = long double,
+          MatrixUtils::MatrixType M>
+Details::SingularBasis<typename M::ElemType>
+SVD(const M &matrix, SVDEngine engine = SVDEngine::Auto) {
     using T = typename M::ElemType;
 
     if (matrix.Rows() < matrix.Columns()) {
-        auto [U, S, VT] = SVD(Matrix<typename M::ElemType>::Conjugated(matrix));
+        auto [U, S, VT] = SVD<Compute>(
+            Matrix<typename M::ElemType>::Conjugated(matrix), engine);
         U.Conjugate();
         VT.Conjugate();
         return {std::move(VT), std::move(S), std::move(U)};
     }
 
-    auto [U1, B, VT1] = Bidiagonalize(matrix);
-    auto B_real = MatrixUtils::CastMatrix<long double>(B);
-    auto [U_real, S_real, VT_real] = BidiagAlgorithmQR(B_real);
+    if constexpr (!std::is_floating_point_v<Compute>) {
+        engine = SVDEngine::BidiagQR;
+    }
+
+    if (engine == SVDEngine::Auto) {
+        engine = Details::SelectSVDEngine(matrix.Rows(), matrix.Columns());
+    }
+
+    if (engine == SVDEngine::Jacobi) {
+        auto [U, S, VT, sweeps, is_converged] = JacobiSVD(matrix);
+        if (is_converged) {
+            return {std::move(U), std::move(S), std::move(VT)};
+        }
+
+        // The sweep limit was reached, the bidiagonal QR takes over.
+        engine = SVDEngine::BidiagQR;
+    }
+
+    auto [U1, B, VT1] = BlockedBidiagonalize(matrix);
+    auto B_real = MatrixUtils::CastMatrix<Compute>(B);
+    auto [U_real, S_real, VT_real] = [&] {
+        if constexpr (std::is_floating_point_v<Compute>) {
+            if (engine == SVDEngine::DivideAndConquer) {
+                return BidiagDivideConquer(B_real);
+            }
+        }
+        return BidiagAlgorithmQR(B_real);
+    }();
 
     Details::ToPositiveSingular(S_real, VT_real);
     Details::SortSingular(U_real, S_real, VT_real);
@@ -96,4 +144,22 @@ Details::SingularBasis<typename M::ElemType> SVD(const M &matrix) {
 
     return {std::move(U), std::move(S), std::move(VT)};
 }
+
+// The 16-bit storage types are decomposed in float.
+template <Utils::Details::FloatingPoint Compute = long double,
+          MatrixUtils::MatrixType M>
+    requires Utils::StorageFloat<typename M::ElemType>
+Details::SingularBasis<Utils::WideType<typename M::ElemType>>
+SVD(const M &matrix, SVDEngine engine = SVDEngine::Auto) {
+    return SVD<Compute>(MatrixUtils::WidenMatrix(matrix), engine);
+}
+
+// Fixed-size matrices always go to the one-sided Jacobi method.
+template <Utils::FloatOrComplex T, IndexType Rows, IndexType Cols>
+    requires(Rows >= 0 && Cols >= 0)
+Details::FixedSingularBasis<T, Rows, Cols>
+SVD(const Matrix<T, Rows, Cols> &matrix,
+    [[maybe_unused]] SVDEngine engine = SVDEngine::Auto) {
+    return Details::FixedJacobiSVD(matrix);
+}
 } // namespace LinearKit::Algorithm
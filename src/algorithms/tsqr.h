@@ -0,0 +1,228 @@
+#pragma once
+
+#include "solve.h"
+
+#include <vector>
+
+namespace LinearKit::Algorithm {
+namespace Details {
+inline constexpr IndexType kTSQRBlockRows = 1024;
+
+// One level of the reduction tree. The node i factors the rows
+// [starts[i], starts[i + 1]) of the level input, and the R factors of the
+// nodes stacked in order are the input of the next level.
+template <Utils::FloatOrComplex T = long double>
+struct TSQRLevel {
+    std::vector<FactorQR<T>> nodes;
+    std::vector<IndexType> starts;
+
+    [[nodiscard]] IndexType OutputRows(IndexType node) const {
+        return nodes[node].tau.size();
+    }
+};
+
+// A = Q * R with the thin Q kept implicitly as the tree of small QR
+// factorizations: the row blocks of A at the first level and the stacked
+// pairs of R factors above it.
+template <Utils::FloatOrComplex T = long double>
+struct FactorTSQR {
+    std::vector<TSQRLevel<T>> levels;
+    IndexType rows = 0;
+    IndexType cols = 0;
+
+    [[nodiscard]] IndexType Rank() const {
+        return std::min(rows, cols);
+    }
+
+    Matrix<T> GetR() const {
+        Matrix<T> R(Rank(), cols);
+        if (levels.empty()) {
+            return R;
+        }
+
+        const auto &QR = levels.back().nodes.front().QR;
+        for (IndexType i = 0; i < Rank(); ++i) {
+            for (IndexType j = i; j < cols; ++j) {
+                R(i, j) = QR(i, j);
+            }
+        }
+
+        return R;
+    }
+
+    // Q^H * B, the first min(rows, cols) rows of it.
+    template <MatrixUtils::MatrixType M>
+    Matrix<T> ApplyQAdjoint(const M &B) const {
+        assert(B.Rows() == rows && "Wrong number of rows.");
+
+        Matrix<T> current = B;
+        if (B.Columns() == 0) {
+            return Matrix<T>(Rank(), 0);
+        }
+
+        for (const auto &level : levels) {
+            IndexType count = level.nodes.size();
+            std::vector<IndexType> outputs(count + 1);
+            for (IndexType i = 0; i < count; ++i) {
+                outputs[i + 1] = outputs[i] + level.OutputRows(i);
+            }
+
+            Matrix<T> next(outputs.back(), B.Columns());
+            Utils::ParallelFor(0, count, [&](std::ptrdiff_t i) {
+                auto part = current.GetSubmatrix(
+                    {level.starts[i], level.starts[i + 1]}, {0, B.Columns()});
+                level.nodes[i].ApplyQ(part, true);
+
+                for (IndexType r = 0; r < level.OutputRows(i); ++r) {
+                    for (IndexType j = 0; j < B.Columns(); ++j) {
+                        next(outputs[i] + r, j) = part(r, j);
+                    }
+                }
+            });
+
+            current = std::move(next);
+        }
+
+        return current;
+    }
+
+    // Q * Y for Y with min(rows, cols) rows.
+    template <MatrixUtils::MatrixType M>
+    Matrix<T> ApplyQ(const M &Y) const {
+        assert(Y.Rows() == Rank() && "Wrong number of rows.");
+
+        Matrix<T> current = Y;
+        if (Y.Columns() == 0) {
+            return Matrix<T>(rows, 0);
+        }
+
+        for (auto it = levels.rbegin(); it != levels.rend(); ++it) {
+            const auto &level = *it;
+
+            IndexType count = level.nodes.size();
+            std::vector<IndexType> outputs(count + 1);
+            for (IndexType i = 0; i < count; ++i) {
+                outputs[i + 1] = outputs[i] + level.OutputRows(i);
+            }
+
+            Matrix<T> next(level.starts.back(), Y.Columns());
+            Utils::ParallelFor(0, count, [&](std::ptrdiff_t i) {
+                auto part = next.GetSubmatrix(
+                    {level.starts[i], level.starts[i + 1]}, {0, Y.Columns()});
+                for (IndexType r = 0; r < level.OutputRows(i); ++r) {
+                    for (IndexType j = 0; j < Y.Columns(); ++j) {
+                        part(r, j) = current(outputs[i] + r, j);
+                    }
+                }
+
+                level.nodes[i].ApplyQ(part, false);
+            });
+
+            current = std::move(next);
+        }
+
+        return current;
+    }
+
+    // The thin Q with min(rows, cols) orthonormal columns.
+    Matrix<T> GetQ() const {
+        return ApplyQ(Matrix<T>::Identity(Rank()));
+    }
+};
+} // namespace Details
+
+// Tall skinny QR: the row blocks of at least block_rows rows are factored in
+// parallel, then their R factors are merged pairwise up a binary tree, so the
+// matrix is read only once. Q is not formed.
+template <MatrixUtils::MatrixType M>
+Details::FactorTSQR<typename M::ElemType>
+TSQR(const M &matrix, IndexType block_rows = Details::kTSQRBlockRows) {
+    using T = typename M::ElemType;
+
+    assert(block_rows > 0 && "Block size must be positive.");
+
+    auto rows = matrix.Rows();
+    auto cols = matrix.Columns();
+
+    Details::FactorTSQR<T> factor{{}, rows, cols};
+    if (rows == 0 || cols == 0) {
+        return factor;
+    }
+
+    // Each leaf gets at least max(block_rows, cols) rows, so only the
+    // last level may have short R factors.
+    IndexType leaves =
+        std::max(IndexType{1}, rows / std::max(block_rows, cols));
+
+    Details::TSQRLevel<T> level;
+    level.nodes.resize(leaves);
+    for (IndexType i = 0; i <= leaves; ++i) {
+        level.starts.push_back(i * rows / leaves);
+    }
+
+    Utils::ParallelFor(0, leaves, [&](std::ptrdiff_t i) {
+        Matrix<T> block(level.starts[i + 1] - level.starts[i], cols);
+        for (IndexType r = 0; r < block.Rows(); ++r) {
+            for (IndexType j = 0; j < cols; ++j) {
+                block(r, j) = matrix(level.starts[i] + r, j);
+            }
+        }
+
+        level.nodes[i] = CompactQR(std::move(block));
+    });
+
+    while (true) {
+        IndexType count = level.nodes.size();
+        factor.levels.push_back(std::move(level));
+        if (count == 1) {
+            break;
+        }
+
+        const auto &last = factor.levels.back();
+
+        Details::TSQRLevel<T> parent;
+        parent.nodes.resize((count + 1) / 2);
+        parent.starts.push_back(0);
+        for (IndexType i = 0; i < count; i += 2) {
+            auto size = last.OutputRows(i);
+            if (i + 1 < count) {
+                size += last.OutputRows(i + 1);
+            }
+            parent.starts.push_back(parent.starts.back() + size);
+        }
+
+        Utils::ParallelFor(0, parent.nodes.size(), [&](std::ptrdiff_t p) {
+            Matrix<T> stacked(parent.starts[p + 1] - parent.starts[p], cols);
+
+            IndexType offset = 0;
+            for (IndexType i = 2 * p; i < std::min(count, 2 * p + 2); ++i) {
+                const auto &QR = last.nodes[i].QR;
+                for (IndexType r = 0; r < last.OutputRows(i); ++r) {
+                    for (IndexType j = r; j < cols; ++j) {
+                        stacked(offset + r, j) = QR(r, j);
+                    }
+                }
+                offset += last.OutputRows(i);
+            }
+
+            parent.nodes[p] = CompactQR(std::move(stacked));
+        });
+
+        level = std::move(parent);
+    }
+
+    return factor;
+}
+
+// min ||A * X - B|| for A with full column rank, given its TSQR.
+template <Utils::FloatOrComplex T, MatrixUtils::MatrixType M>
+Matrix<T> LeastSquares(const Details::FactorTSQR<T> &factor, const M &rhs) {
+    assert(factor.rows >= factor.cols &&
+           "Least squares for matrices with rows >= columns.");
+
+    auto X = factor.ApplyQAdjoint(rhs);
+    Details::SolveTriangular(factor.levels.back().nodes.front().QR, X,
+                             Details::TriangleType::Upper, false, false);
+    return X;
+}
+} // namespace LinearKit::Algorithm
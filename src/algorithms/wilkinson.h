@@ -2,8 +2,33 @@
 
 #include "../matrix_utils/is_matrix_type.h"
 #include "../utils/sign.h"
+#include "closed_form.h"
 
 namespace LinearKit::Algorithm {
+namespace Details {
+// The eigenvalue of [[a, b], [c, d]] closest to d.
+template <Utils::FloatOrComplex T>
+T GetWilkinsonShift2x2(T a, T b, T c, T d) {
+    if constexpr (!Utils::Details::IsFloatComplexT<T>::value) {
+        if (b == c) {
+            auto pair = GetSymmetricEigen2x2(a, b, d);
+            return (Utils::Abs(pair.first - d) < Utils::Abs(pair.second - d))
+                       ? pair.first
+                       : pair.second;
+        }
+    }
+
+    auto delta = (a - d) / T{2};
+    auto b_square = c * b;
+    auto coefficient =
+        Utils::Abs(delta) + Utils::Sqrt(delta * delta + b_square);
+    if (coefficient == T{0}) {
+        return d;
+    }
+    return d - Utils::Sign(delta) * b_square / coefficient;
+}
+} // namespace Details
+
 template <MatrixUtils::MatrixType M>
 typename M::ElemType GetWilkinsonShift(const M &matrix, IndexType end_idx) {
     using T = typename M::ElemType;
@@ -14,33 +39,30 @@ typename M::ElemType GetWilkinsonShift(const M &matrix, IndexType end_idx) {
 
     assert(end_idx >= 2 && end_idx <= matrix.Rows() && "Wrong end index.");
 
-    auto delta =
-        (matrix(end_idx - 2, end_idx - 2) - matrix(end_idx - 1, end_idx - 1)) /
-        T{2};
-    auto b_square =
-        matrix(end_idx - 1, end_idx - 2) * matrix(end_idx - 2, end_idx - 1);
-    auto coefficient = std::abs(delta) + std::sqrt(delta * delta + b_square);
-    return matrix(end_idx - 1, end_idx - 1) -
-           Utils::Sign(delta) * b_square / coefficient;
+    return Details::GetWilkinsonShift2x2(
+        matrix(end_idx - 2, end_idx - 2), matrix(end_idx - 2, end_idx - 1),
+        matrix(end_idx - 1, end_idx - 2), matrix(end_idx - 1, end_idx - 1));
 }
 
+// The shift from the trailing 2 x 2 block of S^T * S, which is computed from
+// the entries of the bidiagonal S directly.
 template <MatrixUtils::MatrixType M>
 typename M::ElemType GetBidiagWilkinsonShift(const M &S) {
     using T = typename M::ElemType;
     assert(S.Columns() >= 2 && "Wrong columns count.");
 
     auto sub_idx = S.Columns();
-    Matrix<T> S_gram =
-        S.GetSubmatrix({sub_idx - 2, sub_idx}, {sub_idx - 2, sub_idx});
-
-    S_gram.Transpose();
-    S_gram *= S.GetSubmatrix({sub_idx - 2, sub_idx}, {sub_idx - 2, sub_idx});
+    auto p = S(sub_idx - 2, sub_idx - 2);
+    auto q = S(sub_idx - 2, sub_idx - 1);
+    auto r = (S.Rows() >= sub_idx) ? S(sub_idx - 1, sub_idx - 2) : T{0};
+    auto s = (S.Rows() >= sub_idx) ? S(sub_idx - 1, sub_idx - 1) : T{0};
 
+    auto a = p * p + r * r;
     if (sub_idx >= 3) {
-        S_gram(0, 0) +=
-            S(sub_idx - 3, sub_idx - 2) * S(sub_idx - 3, sub_idx - 2);
+        a += S(sub_idx - 3, sub_idx - 2) * S(sub_idx - 3, sub_idx - 2);
     }
+    auto b = p * q + r * s;
 
-    return GetWilkinsonShift(S_gram, 2);
+    return Details::GetWilkinsonShift2x2(a, b, b, q * q + s * s);
 }
 } // namespace LinearKit::Algorithm
@@ -13,10 +13,28 @@ Matrix<T> CastMatrix(const M &matrix) {
         if constexpr (Utils::Details::IsFloatComplexT<F>::value) {
             val = T(matrix(i, j).real());
         } else {
-            val = T(matrix(i, j));
+            val = T(static_cast<Utils::RealType<T>>(matrix(i, j)));
         }
     });
 
     return result;
 }
+
+// The copy in the accumulation type of the kernels: the 16-bit storage types
+// go to float, the other matrices are copied as they are.
+template <MatrixType M>
+Matrix<Utils::WideType<typename M::ElemType>> WidenMatrix(const M &matrix) {
+    using T = typename M::ElemType;
+    using W = Utils::WideType<T>;
+
+    if constexpr (std::is_same_v<T, W>) {
+        return Matrix<T>(matrix);
+    } else {
+        Matrix<W> result(matrix.Rows(), matrix.Columns());
+        result.ApplyForEach([&](W &val, auto i, auto j) {
+            val = static_cast<W>(matrix(i, j));
+        });
+        return result;
+    }
+}
 } // namespace LinearKit::MatrixUtils
@@ -39,9 +39,13 @@ bool IsUnitary(const M &matrix,
         return false;
     }
 
-    for (IndexType i = 0; i < matrix.Rows(); ++i) {
-        auto column = matrix.GetColumn(i);
-        if (!Utils::AreEqualFloating(column.GetEuclideanNorm(), T{1}, eps)) {
+    for (IndexType j = 0; j < matrix.Columns(); ++j) {
+        T sq_sum = T{0};
+        for (IndexType i = 0; i < matrix.Rows(); ++i) {
+            sq_sum += std::norm(matrix(i, j));
+        }
+
+        if (!Utils::AreEqualFloating(std::sqrt(sq_sum), T{1}, eps)) {
             return false;
         }
     }
@@ -158,4 +162,23 @@ bool IsHessenberg(const M &matrix,
 
     return true;
 }
+
+// Upper Hessenberg without two consecutive nonzero subdiagonal entries, i.e.
+// upper triangular up to 2x2 diagonal blocks.
+template <MatrixType M>
+bool IsQuasiUpperTriangular(
+    const M &matrix, typename M::ElemType eps = typename M::ElemType{0}) {
+    if (!IsHessenberg(matrix, eps)) {
+        return false;
+    }
+
+    for (IndexType i = 2; i < matrix.Rows(); ++i) {
+        if (!Utils::IsZeroFloating(matrix(i, i - 1), eps) &&
+            !Utils::IsZeroFloating(matrix(i - 1, i - 2), eps)) {
+            return false;
+        }
+    }
+
+    return true;
+}
 } // namespace LinearKit::MatrixUtils
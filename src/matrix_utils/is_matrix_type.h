@@ -4,11 +4,13 @@
 
 namespace LinearKit::MatrixUtils {
 namespace Details {
+using IndexType = LinearKit::Details::Types::IndexType;
+
 template <typename T>
 struct IsMatrixT : std::false_type {};
 
-template <Utils::FloatOrComplex T>
-struct IsMatrixT<Matrix<T>> : std::true_type {};
+template <Utils::FloatOrComplex T, IndexType Rows, IndexType Cols>
+struct IsMatrixT<Matrix<T, Rows, Cols>> : std::true_type {};
 
 template <Utils::FloatOrComplex T>
 struct IsMatrixT<MatrixView<T>> : std::true_type {};
@@ -19,11 +21,18 @@ struct IsMatrixT<ConstMatrixView<T>> : std::true_type {};
 template <typename T>
 struct IsMutableMatrixT : std::false_type {};
 
-template <Utils::FloatOrComplex T>
-struct IsMutableMatrixT<Matrix<T>> : std::true_type {};
+template <Utils::FloatOrComplex T, IndexType Rows, IndexType Cols>
+struct IsMutableMatrixT<Matrix<T, Rows, Cols>> : std::true_type {};
 
 template <Utils::FloatOrComplex T>
 struct IsMutableMatrixT<MatrixView<T>> : std::true_type {};
+
+template <typename T>
+struct IsFixedMatrixT : std::false_type {};
+
+template <Utils::FloatOrComplex T, IndexType Rows, IndexType Cols>
+    requires(Rows >= 0 && Cols >= 0)
+struct IsFixedMatrixT<Matrix<T, Rows, Cols>> : std::true_type {};
 } // namespace Details
 
 template <typename T>
@@ -32,4 +41,9 @@ concept MatrixType = Details::IsMatrixT<std::remove_cv_t<T>>::value;
 template <typename T>
 concept MutableMatrixType =
     Details::IsMutableMatrixT<std::remove_cv_t<T>>::value;
+
+// Matrix<T, Rows, Cols> with both sizes known at compile time.
+template <typename T>
+concept FixedMatrixType =
+    MatrixType<T> && Details::IsFixedMatrixT<std::remove_cv_t<T>>::value;
 } // namespace LinearKit::MatrixUtils
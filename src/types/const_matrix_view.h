@@ -80,6 +80,18 @@ public:
         return (*ptr_)(row_.begin + row_idx, column_.begin + col_idx);
     }
 
+    // The address of the stored entry behind (row_idx, col_idx).
+    const T *GetAddress(IndexType row_idx, IndexType col_idx) const {
+        assert(ptr_ != nullptr && "Matrix pointer is null.");
+
+        if (state_.is_transposed == TransposeState::Transposed) {
+            return ptr_->GetAddress(column_.begin + col_idx,
+                                    row_.begin + row_idx);
+        }
+
+        return ptr_->GetAddress(row_.begin + row_idx, column_.begin + col_idx);
+    }
+
     [[nodiscard]] IndexType Rows() const {
         assert(ptr_ != nullptr && "Matrix pointer is null.");
         auto min = (state_.is_transposed == TransposeState::Transposed)
@@ -120,9 +132,13 @@ public:
         assert(Rows() == 1 ||
                Columns() == 1 && "Euclidean norm only for vectors.");
 
-        T sq_sum = T{0};
-        ForEach([&](const T &value) { sq_sum += std::norm(value); });
-        return std::sqrt(sq_sum);
+        using W = Utils::WideType<T>;
+
+        W sq_sum = W{0};
+        ForEach([&](const T &value) {
+            sq_sum += Utils::Norm(static_cast<W>(value));
+        });
+        return static_cast<T>(Utils::Sqrt(sq_sum));
     }
 
     Matrix<T> GetDiag() const {
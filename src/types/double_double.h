@@ -0,0 +1,228 @@
+#pragma once
+
+#include "../utils/are_equal_floating.h"
+#include "../utils/sign.h"
+
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <ostream>
+#include <tuple>
+
+namespace LinearKit {
+// The unevaluated sum hi + lo of two doubles with |lo| <= ulp(hi) / 2, which
+// carries 106 bits of mantissa. The operations are built from the error-free
+// transformations below, plain double additions and fused multiply-adds.
+// It trades speed for precision: an operation costs several long double ones.
+class DoubleDouble {
+public:
+    constexpr DoubleDouble() = default;
+
+    template <typename F>
+        requires std::integral<F> || std::floating_point<F>
+    constexpr DoubleDouble(F value)
+        : hi_(static_cast<double>(value)),
+          lo_(static_cast<double>(value - static_cast<F>(hi_))) {
+    }
+
+    static constexpr DoubleDouble FromParts(double hi, double lo) {
+        DoubleDouble result;
+        result.hi_ = hi;
+        result.lo_ = lo;
+        return result;
+    }
+
+    [[nodiscard]] constexpr double High() const {
+        return hi_;
+    }
+
+    [[nodiscard]] constexpr double Low() const {
+        return lo_;
+    }
+
+    template <typename F>
+        requires std::floating_point<F>
+    explicit constexpr operator F() const {
+        return static_cast<F>(hi_) + static_cast<F>(lo_);
+    }
+
+    friend constexpr DoubleDouble operator-(DoubleDouble value) {
+        return FromParts(-value.hi_, -value.lo_);
+    }
+
+    friend DoubleDouble operator+(DoubleDouble lhs, DoubleDouble rhs) {
+        auto [s, e] = TwoSum(lhs.hi_, rhs.hi_);
+        auto [t, f] = TwoSum(lhs.lo_, rhs.lo_);
+        e += t;
+        std::tie(s, e) = QuickTwoSum(s, e);
+        e += f;
+        std::tie(s, e) = QuickTwoSum(s, e);
+        return FromParts(s, e);
+    }
+
+    friend DoubleDouble operator-(DoubleDouble lhs, DoubleDouble rhs) {
+        return lhs + (-rhs);
+    }
+
+    friend DoubleDouble operator*(DoubleDouble lhs, DoubleDouble rhs) {
+        auto [p, e] = TwoProd(lhs.hi_, rhs.hi_);
+        e += lhs.hi_ * rhs.lo_ + lhs.lo_ * rhs.hi_;
+        std::tie(p, e) = QuickTwoSum(p, e);
+        return FromParts(p, e);
+    }
+
+    // Long division with three double quotients.
+    friend DoubleDouble operator/(DoubleDouble lhs, DoubleDouble rhs) {
+        auto q1 = lhs.hi_ / rhs.hi_;
+        auto r = lhs - rhs * DoubleDouble(q1);
+        auto q2 = r.hi_ / rhs.hi_;
+        r = r - rhs * DoubleDouble(q2);
+        auto q3 = r.hi_ / rhs.hi_;
+
+        auto [q, e] = QuickTwoSum(q1, q2);
+        return FromParts(q, e) + DoubleDouble(q3);
+    }
+
+    DoubleDouble &operator+=(DoubleDouble rhs) {
+        return *this = *this + rhs;
+    }
+
+    DoubleDouble &operator-=(DoubleDouble rhs) {
+        return *this = *this - rhs;
+    }
+
+    DoubleDouble &operator*=(DoubleDouble rhs) {
+        return *this = *this * rhs;
+    }
+
+    DoubleDouble &operator/=(DoubleDouble rhs) {
+        return *this = *this / rhs;
+    }
+
+    friend constexpr bool operator==(DoubleDouble lhs, DoubleDouble rhs) {
+        return lhs.hi_ == rhs.hi_ && lhs.lo_ == rhs.lo_;
+    }
+
+    friend constexpr bool operator<(DoubleDouble lhs, DoubleDouble rhs) {
+        return lhs.hi_ < rhs.hi_ || (lhs.hi_ == rhs.hi_ && lhs.lo_ < rhs.lo_);
+    }
+
+    friend constexpr bool operator>(DoubleDouble lhs, DoubleDouble rhs) {
+        return rhs < lhs;
+    }
+
+    friend constexpr bool operator<=(DoubleDouble lhs, DoubleDouble rhs) {
+        return !(rhs < lhs);
+    }
+
+    friend constexpr bool operator>=(DoubleDouble lhs, DoubleDouble rhs) {
+        return !(lhs < rhs);
+    }
+
+    friend constexpr DoubleDouble abs(DoubleDouble value) {
+        return (value.hi_ < 0) ? -value : value;
+    }
+
+    // One Newton step from the double root doubles its precision.
+    friend DoubleDouble sqrt(DoubleDouble value) {
+        if (!(value.hi_ > 0)) {
+            return DoubleDouble(std::sqrt(value.hi_));
+        }
+
+        auto root = std::sqrt(value.hi_);
+        auto [square, error] = TwoProd(root, root);
+        auto residual = value - FromParts(square, error);
+        return DoubleDouble(root) + DoubleDouble(residual.hi_ / (2 * root));
+    }
+
+    friend std::ostream &operator<<(std::ostream &ostream,
+                                    DoubleDouble value) {
+        return ostream << static_cast<long double>(value);
+    }
+
+private:
+    // a + b = s + e exactly.
+    static constexpr std::pair<double, double> TwoSum(double a, double b) {
+        auto s = a + b;
+        auto v = s - a;
+        auto e = (a - (s - v)) + (b - v);
+        return {s, e};
+    }
+
+    // a + b = s + e exactly for |a| >= |b|.
+    static constexpr std::pair<double, double> QuickTwoSum(double a,
+                                                           double b) {
+        auto s = a + b;
+        return {s, b - (s - a)};
+    }
+
+    // a * b = p + e exactly.
+    static std::pair<double, double> TwoProd(double a, double b) {
+        auto p = a * b;
+        return {p, std::fma(a, b, -p)};
+    }
+
+    double hi_ = 0;
+    double lo_ = 0;
+};
+
+namespace Utils {
+namespace Details {
+template <>
+struct IsExtendedFloatT<DoubleDouble> : std::true_type {};
+
+template <>
+struct TypeEpsilon<DoubleDouble> {
+    static constexpr DoubleDouble kValue = 1e-25;
+};
+} // namespace Details
+
+// The sign of the sum is the sign of the leading part.
+template <>
+inline DoubleDouble Sign(DoubleDouble value) {
+    return (value.High() >= 0) ? DoubleDouble(1) : DoubleDouble(-1);
+}
+} // namespace Utils
+} // namespace LinearKit
+
+template <>
+class std::numeric_limits<LinearKit::DoubleDouble> {
+    using DoubleDouble = LinearKit::DoubleDouble;
+    using Double = std::numeric_limits<double>;
+
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 2 * Double::digits;
+    static constexpr int digits10 = 31;
+    static constexpr int radix = 2;
+
+    static constexpr DoubleDouble epsilon() {
+        return DoubleDouble::FromParts(0x1p-104, 0);
+    }
+
+    static constexpr DoubleDouble min() {
+        // Below it the low part is subnormal.
+        return DoubleDouble::FromParts(Double::min() * 0x1p53, 0);
+    }
+
+    static constexpr DoubleDouble max() {
+        return DoubleDouble::FromParts(Double::max(), 0);
+    }
+
+    static constexpr DoubleDouble lowest() {
+        return DoubleDouble::FromParts(Double::lowest(), 0);
+    }
+
+    static constexpr DoubleDouble infinity() {
+        return DoubleDouble::FromParts(Double::infinity(), 0);
+    }
+
+    static constexpr DoubleDouble quiet_NaN() {
+        return DoubleDouble::FromParts(Double::quiet_NaN(), 0);
+    }
+};
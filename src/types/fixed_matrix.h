@@ -0,0 +1,245 @@
+#pragma once
+
+#include "../matrix_utils/is_matrix_type.h"
+#include "../utils/sign.h"
+#include "types_details.h"
+
+#include <array>
+#include <ostream>
+
+namespace LinearKit {
+// Matrix with the sizes fixed at compile time. The entries are stored inline
+// in row-major order, so there are no heap allocations, and the loops below
+// have constant bounds, which the compiler unrolls for small sizes. Converts
+// to Matrix<T>, so the algorithms without a fixed-size overload accept it.
+template <Utils::FloatOrComplex T, Details::Types::IndexType RowCnt,
+          Details::Types::IndexType ColCnt>
+    requires(RowCnt >= 0 && ColCnt >= 0)
+class Matrix<T, RowCnt, ColCnt> {
+    using IndexType = Details::Types::IndexType;
+
+public:
+    using ElemType = std::remove_cv_t<T>;
+
+    constexpr Matrix() = default;
+
+    constexpr Matrix(std::initializer_list<std::initializer_list<T>> list) {
+        assert(list.size() == RowCnt && "Wrong number of rows.");
+
+        IndexType i = 0;
+        for (auto sublist : list) {
+            assert(sublist.size() == ColCnt &&
+                   "Size of matrix rows must be equal to the number of "
+                   "columns.");
+
+            IndexType j = 0;
+            for (auto value : sublist) {
+                (*this)(i, j++) = value;
+            }
+            ++i;
+        }
+    }
+
+    template <MatrixUtils::MatrixType M>
+        requires(!std::is_same_v<std::remove_cv_t<M>, Matrix>)
+    explicit Matrix(const M &rhs) {
+        assert(rhs.Rows() == RowCnt && rhs.Columns() == ColCnt &&
+               "Wrong matrix size.");
+
+        for (IndexType i = 0; i < RowCnt; ++i) {
+            for (IndexType j = 0; j < ColCnt; ++j) {
+                (*this)(i, j) = rhs(i, j);
+            }
+        }
+    }
+
+    constexpr T &operator()(IndexType row_idx, IndexType col_idx) {
+        assert(row_idx < RowCnt && col_idx < ColCnt &&
+               "Requested indexes are outside the matrix boundaries.");
+        return data_[ColCnt * row_idx + col_idx];
+    }
+
+    constexpr T operator()(IndexType row_idx, IndexType col_idx) const {
+        assert(row_idx < RowCnt && col_idx < ColCnt &&
+               "Requested indexes are outside the matrix boundaries.");
+        return data_[ColCnt * row_idx + col_idx];
+    }
+
+    [[nodiscard]] static constexpr IndexType Rows() {
+        return RowCnt;
+    }
+
+    [[nodiscard]] static constexpr IndexType Columns() {
+        return ColCnt;
+    }
+
+    operator Matrix<T>() const {
+        Matrix<T> result(RowCnt, ColCnt);
+        for (IndexType i = 0; i < RowCnt; ++i) {
+            for (IndexType j = 0; j < ColCnt; ++j) {
+                result(i, j) = (*this)(i, j);
+            }
+        }
+
+        return result;
+    }
+
+    // Unlike the dynamic matrix, returns a copy instead of a view.
+    static constexpr Matrix<T, ColCnt, RowCnt> Transposed(const Matrix &rhs) {
+        Matrix<T, ColCnt, RowCnt> result;
+        for (IndexType i = 0; i < RowCnt; ++i) {
+            for (IndexType j = 0; j < ColCnt; ++j) {
+                result(j, i) = rhs(i, j);
+            }
+        }
+
+        return result;
+    }
+
+    static constexpr Matrix<T, ColCnt, RowCnt> Conjugated(const Matrix &rhs) {
+        Matrix<T, ColCnt, RowCnt> result;
+        for (IndexType i = 0; i < RowCnt; ++i) {
+            for (IndexType j = 0; j < ColCnt; ++j) {
+                result(j, i) = Utils::Conj(rhs(i, j));
+            }
+        }
+
+        return result;
+    }
+
+    static constexpr Matrix Identity()
+        requires(RowCnt == ColCnt)
+    {
+        Matrix result;
+        for (IndexType i = 0; i < RowCnt; ++i) {
+            result(i, i) = T{1};
+        }
+
+        return result;
+    }
+
+    friend std::ostream &operator<<(std::ostream &ostream,
+                                    const Matrix &matrix) {
+        return ostream << Matrix<T>(matrix);
+    }
+
+private:
+    std::array<T, RowCnt * ColCnt> data_{};
+};
+
+template <Utils::FloatOrComplex T, Details::Types::IndexType Rows,
+          Details::Types::IndexType Cols>
+    requires(Rows >= 0 && Cols >= 0)
+constexpr Matrix<T, Rows, Cols> operator+(Matrix<T, Rows, Cols> lhs,
+                                          const Matrix<T, Rows, Cols> &rhs) {
+    return lhs += rhs;
+}
+
+template <Utils::FloatOrComplex T, Details::Types::IndexType Rows,
+          Details::Types::IndexType Cols>
+    requires(Rows >= 0 && Cols >= 0)
+constexpr Matrix<T, Rows, Cols> &operator+=(Matrix<T, Rows, Cols> &lhs,
+                                            const Matrix<T, Rows, Cols> &rhs) {
+    for (Details::Types::IndexType i = 0; i < Rows; ++i) {
+        for (Details::Types::IndexType j = 0; j < Cols; ++j) {
+            lhs(i, j) += rhs(i, j);
+        }
+    }
+
+    return lhs;
+}
+
+template <Utils::FloatOrComplex T, Details::Types::IndexType Rows,
+          Details::Types::IndexType Cols>
+    requires(Rows >= 0 && Cols >= 0)
+constexpr Matrix<T, Rows, Cols> operator-(Matrix<T, Rows, Cols> lhs,
+                                          const Matrix<T, Rows, Cols> &rhs) {
+    return lhs -= rhs;
+}
+
+template <Utils::FloatOrComplex T, Details::Types::IndexType Rows,
+          Details::Types::IndexType Cols>
+    requires(Rows >= 0 && Cols >= 0)
+constexpr Matrix<T, Rows, Cols> &operator-=(Matrix<T, Rows, Cols> &lhs,
+                                            const Matrix<T, Rows, Cols> &rhs) {
+    for (Details::Types::IndexType i = 0; i < Rows; ++i) {
+        for (Details::Types::IndexType j = 0; j < Cols; ++j) {
+            lhs(i, j) -= rhs(i, j);
+        }
+    }
+
+    return lhs;
+}
+
+// Unlike the dynamic product, small entries are not rounded to zero, so the
+// product stays constexpr.
+template <Utils::FloatOrComplex T, Details::Types::IndexType Rows,
+          Details::Types::IndexType Inner, Details::Types::IndexType Cols>
+    requires(Rows >= 0 && Inner >= 0 && Cols >= 0)
+constexpr Matrix<T, Rows, Cols> operator*(const Matrix<T, Rows, Inner> &lhs,
+                                          const Matrix<T, Inner, Cols> &rhs) {
+    Matrix<T, Rows, Cols> result;
+    for (Details::Types::IndexType i = 0; i < Rows; ++i) {
+        for (Details::Types::IndexType k = 0; k < Inner; ++k) {
+            auto coeff = lhs(i, k);
+            for (Details::Types::IndexType j = 0; j < Cols; ++j) {
+                result(i, j) += coeff * rhs(k, j);
+            }
+        }
+    }
+
+    return result;
+}
+
+template <Utils::FloatOrComplex T, Details::Types::IndexType Rows,
+          Details::Types::IndexType Cols>
+    requires(Rows >= 0 && Cols >= 0)
+constexpr Matrix<T, Rows, Cols> &operator*=(Matrix<T, Rows, Cols> &lhs,
+                                            std::type_identity_t<T> scalar) {
+    for (Details::Types::IndexType i = 0; i < Rows; ++i) {
+        for (Details::Types::IndexType j = 0; j < Cols; ++j) {
+            lhs(i, j) *= scalar;
+        }
+    }
+
+    return lhs;
+}
+
+template <Utils::FloatOrComplex T, Details::Types::IndexType Rows,
+          Details::Types::IndexType Cols>
+    requires(Rows >= 0 && Cols >= 0)
+constexpr Matrix<T, Rows, Cols> operator*(Matrix<T, Rows, Cols> lhs,
+                                          std::type_identity_t<T> scalar) {
+    return lhs *= scalar;
+}
+
+template <Utils::FloatOrComplex T, Details::Types::IndexType Rows,
+          Details::Types::IndexType Cols>
+    requires(Rows >= 0 && Cols >= 0)
+constexpr Matrix<T, Rows, Cols> operator*(std::type_identity_t<T> scalar,
+                                          Matrix<T, Rows, Cols> rhs) {
+    return rhs *= scalar;
+}
+
+template <Utils::FloatOrComplex T, Details::Types::IndexType Rows,
+          Details::Types::IndexType Cols>
+    requires(Rows >= 0 && Cols >= 0)
+constexpr Matrix<T, Rows, Cols> &operator/=(Matrix<T, Rows, Cols> &lhs,
+                                            std::type_identity_t<T> scalar) {
+    for (Details::Types::IndexType i = 0; i < Rows; ++i) {
+        for (Details::Types::IndexType j = 0; j < Cols; ++j) {
+            lhs(i, j) /= scalar;
+        }
+    }
+
+    return lhs;
+}
+
+template <Utils::FloatOrComplex T, Details::Types::IndexType Rows,
+          Details::Types::IndexType Cols>
+    requires(Rows >= 0 && Cols >= 0)
+constexpr Matrix<T, Rows, Cols> operator/(Matrix<T, Rows, Cols> lhs,
+                                          std::type_identity_t<T> scalar) {
+    return lhs /= scalar;
+}
+} // namespace LinearKit
@@ -0,0 +1,279 @@
+#pragma once
+
+#include "../utils/are_equal_floating.h"
+
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+
+namespace LinearKit {
+namespace Details {
+// IEEE binary16: 11 bits of mantissa, 5 bits of exponent. The conversions go
+// through the compiler type _Float16 (F16C instructions where available) if
+// the compiler has it, and through the bit manipulations below otherwise.
+struct Binary16Format {
+    static constexpr int kDigits = 11;
+    static constexpr std::uint16_t kEpsilon = 0x1400;
+    static constexpr std::uint16_t kMin = 0x0400;
+    static constexpr std::uint16_t kMax = 0x7BFF;
+    static constexpr std::uint16_t kInfinity = 0x7C00;
+    static constexpr std::uint16_t kQuietNaN = 0x7E00;
+
+    static constexpr float ToFloat(std::uint16_t bits) {
+#ifdef __FLT16_MAX__
+        return static_cast<float>(std::bit_cast<_Float16>(bits));
+#else
+        return SoftwareToFloat(bits);
+#endif
+    }
+
+    static constexpr std::uint16_t FromFloat(float value) {
+#ifdef __FLT16_MAX__
+        return std::bit_cast<std::uint16_t>(static_cast<_Float16>(value));
+#else
+        return SoftwareFromFloat(value);
+#endif
+    }
+
+    static constexpr float SoftwareToFloat(std::uint16_t bits) {
+        auto sign = static_cast<std::uint32_t>(bits & 0x8000) << 16;
+        auto exponent = static_cast<std::uint32_t>(bits >> 10) & 0x1F;
+        auto mantissa = static_cast<std::uint32_t>(bits & 0x03FF);
+
+        if (exponent == 0x1F) {
+            return std::bit_cast<float>(sign | 0x7F800000 | (mantissa << 13));
+        }
+        if (exponent == 0) {
+            // Zero or subnormal: mantissa * 2^-24 is exact in float.
+            auto value = static_cast<float>(mantissa) * 0x1p-24f;
+            return sign ? -value : value;
+        }
+        return std::bit_cast<float>(sign | ((exponent + 112) << 23) |
+                                    (mantissa << 13));
+    }
+
+    // Rounds to nearest even, overflows to infinity; NaN stays quiet NaN.
+    static constexpr std::uint16_t SoftwareFromFloat(float value) {
+        auto bits = std::bit_cast<std::uint32_t>(value);
+        auto sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000);
+        bits &= 0x7FFFFFFF;
+
+        if (bits > 0x7F800000) {
+            return sign | kQuietNaN;
+        }
+        // 65520 is halfway between kMax and 2^16 and rounds to the even one.
+        if (bits >= 0x477FF000) {
+            return sign | kInfinity;
+        }
+        if (bits < 0x38800000) {
+            // Below 2^-14 the result is subnormal: adding 0.5 leaves the
+            // float with the ulp 2^-24 of binary16, and the addition rounds.
+            auto sum = std::bit_cast<float>(bits) + 0.5f;
+            return sign | static_cast<std::uint16_t>(
+                              std::bit_cast<std::uint32_t>(sum) - 0x3F000000);
+        }
+
+        auto odd = (bits >> 13) & 1;
+        bits += (static_cast<std::uint32_t>(15 - 127) << 23) + 0x0FFF + odd;
+        return sign | static_cast<std::uint16_t>(bits >> 13);
+    }
+};
+
+// bfloat16: the upper half of binary32, with its range and 8 bits of
+// mantissa.
+struct BFloat16Format {
+    static constexpr int kDigits = 8;
+    static constexpr std::uint16_t kEpsilon = 0x3C00;
+    static constexpr std::uint16_t kMin = 0x0080;
+    static constexpr std::uint16_t kMax = 0x7F7F;
+    static constexpr std::uint16_t kInfinity = 0x7F80;
+    static constexpr std::uint16_t kQuietNaN = 0x7FC0;
+
+    static constexpr float ToFloat(std::uint16_t bits) {
+        return std::bit_cast<float>(static_cast<std::uint32_t>(bits) << 16);
+    }
+
+    // Rounds to nearest even; NaN stays quiet NaN.
+    static constexpr std::uint16_t FromFloat(float value) {
+        auto bits = std::bit_cast<std::uint32_t>(value);
+        if (value != value) {
+            return static_cast<std::uint16_t>((bits >> 16) | 0x0040);
+        }
+        bits += 0x7FFF + ((bits >> 16) & 1);
+        return static_cast<std::uint16_t>(bits >> 16);
+    }
+};
+} // namespace Details
+
+// A 16-bit storage type: it halves the memory of the stored matrices, but
+// gives no faster arithmetic. Every operation is done in float and rounded
+// back, so the kernels over long sums widen to Utils::WideType (float) and
+// narrow only the result, and the decompositions work on a float copy.
+template <typename Format>
+class HalfFloat {
+public:
+    constexpr HalfFloat() = default;
+
+    template <typename F>
+        requires std::integral<F> || std::floating_point<F>
+    constexpr HalfFloat(F value)
+        : bits_(Format::FromFloat(static_cast<float>(value))) {
+    }
+
+    static constexpr HalfFloat FromBits(std::uint16_t bits) {
+        HalfFloat result;
+        result.bits_ = bits;
+        return result;
+    }
+
+    [[nodiscard]] constexpr std::uint16_t Bits() const {
+        return bits_;
+    }
+
+    template <typename F>
+        requires std::floating_point<F>
+    explicit constexpr operator F() const {
+        return static_cast<F>(Format::ToFloat(bits_));
+    }
+
+    friend constexpr HalfFloat operator-(HalfFloat value) {
+        return FromBits(value.bits_ ^ 0x8000);
+    }
+
+    friend constexpr HalfFloat operator+(HalfFloat lhs, HalfFloat rhs) {
+        return HalfFloat(lhs.Widen() + rhs.Widen());
+    }
+
+    friend constexpr HalfFloat operator-(HalfFloat lhs, HalfFloat rhs) {
+        return HalfFloat(lhs.Widen() - rhs.Widen());
+    }
+
+    friend constexpr HalfFloat operator*(HalfFloat lhs, HalfFloat rhs) {
+        return HalfFloat(lhs.Widen() * rhs.Widen());
+    }
+
+    friend constexpr HalfFloat operator/(HalfFloat lhs, HalfFloat rhs) {
+        return HalfFloat(lhs.Widen() / rhs.Widen());
+    }
+
+    constexpr HalfFloat &operator+=(HalfFloat rhs) {
+        return *this = *this + rhs;
+    }
+
+    constexpr HalfFloat &operator-=(HalfFloat rhs) {
+        return *this = *this - rhs;
+    }
+
+    constexpr HalfFloat &operator*=(HalfFloat rhs) {
+        return *this = *this * rhs;
+    }
+
+    constexpr HalfFloat &operator/=(HalfFloat rhs) {
+        return *this = *this / rhs;
+    }
+
+    friend constexpr bool operator==(HalfFloat lhs, HalfFloat rhs) {
+        return lhs.Widen() == rhs.Widen();
+    }
+
+    friend constexpr bool operator<(HalfFloat lhs, HalfFloat rhs) {
+        return lhs.Widen() < rhs.Widen();
+    }
+
+    friend constexpr bool operator>(HalfFloat lhs, HalfFloat rhs) {
+        return rhs < lhs;
+    }
+
+    friend constexpr bool operator<=(HalfFloat lhs, HalfFloat rhs) {
+        return lhs.Widen() <= rhs.Widen();
+    }
+
+    friend constexpr bool operator>=(HalfFloat lhs, HalfFloat rhs) {
+        return rhs <= lhs;
+    }
+
+    friend constexpr HalfFloat abs(HalfFloat value) {
+        return FromBits(value.bits_ & 0x7FFF);
+    }
+
+    friend HalfFloat sqrt(HalfFloat value) {
+        return HalfFloat(std::sqrt(value.Widen()));
+    }
+
+    friend std::ostream &operator<<(std::ostream &ostream, HalfFloat value) {
+        return ostream << value.Widen();
+    }
+
+private:
+    [[nodiscard]] constexpr float Widen() const {
+        return Format::ToFloat(bits_);
+    }
+
+    std::uint16_t bits_ = 0;
+};
+
+using Float16 = HalfFloat<Details::Binary16Format>;
+using BFloat16 = HalfFloat<Details::BFloat16Format>;
+
+namespace Utils::Details {
+template <typename Format>
+struct IsExtendedFloatT<HalfFloat<Format>> : std::true_type {};
+
+template <typename Format>
+struct WideT<HalfFloat<Format>> {
+    using Type = float;
+};
+
+template <>
+struct TypeEpsilon<Float16> {
+    static constexpr Float16 kValue = 1e-3;
+};
+
+template <>
+struct TypeEpsilon<BFloat16> {
+    static constexpr BFloat16 kValue = 1e-2;
+};
+} // namespace Utils::Details
+} // namespace LinearKit
+
+template <typename Format>
+class std::numeric_limits<LinearKit::HalfFloat<Format>> {
+    using HalfFloat = LinearKit::HalfFloat<Format>;
+
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = Format::kDigits;
+    static constexpr int radix = 2;
+
+    static constexpr HalfFloat epsilon() {
+        return HalfFloat::FromBits(Format::kEpsilon);
+    }
+
+    static constexpr HalfFloat min() {
+        return HalfFloat::FromBits(Format::kMin);
+    }
+
+    static constexpr HalfFloat max() {
+        return HalfFloat::FromBits(Format::kMax);
+    }
+
+    static constexpr HalfFloat lowest() {
+        return -max();
+    }
+
+    static constexpr HalfFloat infinity() {
+        return HalfFloat::FromBits(Format::kInfinity);
+    }
+
+    static constexpr HalfFloat quiet_NaN() {
+        return HalfFloat::FromBits(Format::kQuietNaN);
+    }
+};
@@ -2,7 +2,9 @@
 
 #include "../matrix_utils/is_matrix_type.h"
 #include "const_matrix_view.h"
+#include "fixed_matrix.h"
 #include "matrix_view.h"
+#include "transpose.h"
 #include "types_details.h"
 
 #include <istream>
@@ -10,8 +12,13 @@
 #include <vector>
 
 namespace LinearKit {
-template <Utils::FloatOrComplex T = long double>
+template <Utils::FloatOrComplex T, Details::Types::IndexType RowCnt,
+          Details::Types::IndexType ColCnt>
 class Matrix {
+    static_assert(RowCnt == Details::Types::kDynamic &&
+                      ColCnt == Details::Types::kDynamic,
+                  "Both sizes must be either fixed or dynamic.");
+
     using Data = std::vector<T>;
     using IndexType = Details::Types::IndexType;
     using Segment = Details::Types::Segment;
@@ -89,6 +96,14 @@ public:
         return buffer_[Columns() * row_idx + col_idx];
     }
 
+    // The address of the stored entry, to tell whether two matrices share
+    // the storage.
+    const T *GetAddress(IndexType row_idx, IndexType col_idx) const {
+        assert(Columns() * row_idx + col_idx < buffer_.size() &&
+               "Requested indexes are outside the matrix boundaries.");
+        return &buffer_[Columns() * row_idx + col_idx];
+    }
+
     [[nodiscard]] IndexType Rows() const {
         return (cols_ == 0) ? IndexType{0} : buffer_.size() / cols_;
     }
@@ -158,36 +173,12 @@ public:
     }
 
     Matrix &Transpose() {
-        std::vector<bool> visited(buffer_.size(), false);
-        IndexType last_idx = buffer_.size() - 1;
-
-        for (IndexType i = 1; i < buffer_.size(); ++i) {
-            if (visited[i]) {
-                continue;
-            }
-
-            auto swap_idx = i;
-            do {
-                swap_idx = (swap_idx == last_idx)
-                               ? last_idx
-                               : (Rows() * swap_idx) % last_idx;
-                std::swap(buffer_[swap_idx], buffer_[i]);
-                visited[swap_idx] = true;
-            } while (swap_idx != i);
-        }
-
-        cols_ = Rows();
-        return *this;
+        return TransposeImpl<false>();
     }
 
+    // The transpose and the conjugation are fused into a single pass.
     Matrix &Conjugate() {
-        Transpose();
-
-        if constexpr (Utils::Details::IsFloatComplexT<T>::value) {
-            ApplyForEach([](T &val) { val = std::conj(val); });
-        }
-
-        return *this;
+        return TransposeImpl<Utils::Details::IsFloatComplexT<T>::value>();
     }
 
     Matrix &Normalize() {
@@ -258,10 +249,21 @@ public:
         return Matrix::Conjugated(view);
     }
 
+    // A temporary is conjugated in its own buffer instead of being viewed.
+    static Matrix Conjugated(Matrix &&rhs) {
+        rhs.Conjugate();
+        return std::move(rhs);
+    }
+
     static Matrix Normalized(const Matrix &rhs) {
         return Matrix::Normalized(rhs.View());
     }
 
+    static Matrix Normalized(Matrix &&rhs) {
+        rhs.Normalize();
+        return std::move(rhs);
+    }
+
     static Matrix Normalized(const MatrixView<T> &rhs) {
         return Matrix::Normalized(rhs.ConstView());
     }
@@ -357,6 +359,23 @@ public:
     }
 
 private:
+    // Square matrices are transposed in place, the others through a buffer.
+    template <bool kConjugate>
+    Matrix &TransposeImpl() {
+        auto rows = Rows();
+        if (rows == cols_) {
+            Details::TransposeSquareInPlace<kConjugate>(buffer_.data(), rows);
+            return *this;
+        }
+
+        Data result(buffer_.size());
+        Details::TransposeTiled<kConjugate>(buffer_.data(), result.data(), rows,
+                                            cols_);
+        buffer_ = std::move(result);
+        cols_ = rows;
+        return *this;
+    }
+
     static IndexType CorrectSize(IndexType size) {
         return std::max(IndexType{0}, size);
     }
@@ -398,6 +417,27 @@ F &operator+=(F &lhs, const S &rhs) {
     return lhs;
 }
 
+// The overloads for temporaries reuse their buffers, so chains like
+// A * B + C allocate once.
+template <Utils::FloatOrComplex T, MatrixUtils::MatrixType S>
+Matrix<T> operator+(Matrix<T> &&lhs, const S &rhs) {
+    lhs += rhs;
+    return std::move(lhs);
+}
+
+template <MatrixUtils::MatrixType F, Utils::FloatOrComplex T>
+    requires std::is_same_v<typename F::ElemType, T>
+Matrix<T> operator+(const F &lhs, Matrix<T> &&rhs) {
+    rhs += lhs;
+    return std::move(rhs);
+}
+
+template <Utils::FloatOrComplex T>
+Matrix<T> operator+(Matrix<T> &&lhs, Matrix<T> &&rhs) {
+    lhs += rhs;
+    return std::move(lhs);
+}
+
 template <MatrixUtils::MatrixType F, MatrixUtils::MatrixType S>
 Matrix<typename F::ElemType> operator-(const F &lhs, const S &rhs) {
     using T = typename F::ElemType;
@@ -429,6 +469,33 @@ F &operator-=(F &lhs, const S &rhs) {
     return lhs;
 }
 
+template <Utils::FloatOrComplex T, MatrixUtils::MatrixType S>
+Matrix<T> operator-(Matrix<T> &&lhs, const S &rhs) {
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
+template <MatrixUtils::MatrixType F, Utils::FloatOrComplex T>
+    requires std::is_same_v<typename F::ElemType, T>
+Matrix<T> operator-(const F &lhs, Matrix<T> &&rhs) {
+    assert(lhs.Rows() == rhs.Rows() && lhs.Columns() == rhs.Columns() &&
+           "Matrices must have the same size for subtraction.");
+
+    for (IndexType i = 0; i < rhs.Rows(); ++i) {
+        for (IndexType j = 0; j < rhs.Columns(); ++j) {
+            rhs(i, j) = lhs(i, j) - rhs(i, j);
+        }
+    }
+
+    return std::move(rhs);
+}
+
+template <Utils::FloatOrComplex T>
+Matrix<T> operator-(Matrix<T> &&lhs, Matrix<T> &&rhs) {
+    lhs -= rhs;
+    return std::move(lhs);
+}
+
 template <MatrixUtils::MatrixType F, MatrixUtils::MatrixType S>
 Matrix<typename F::ElemType> operator*(const F &lhs, const S &rhs) {
     using T = typename F::ElemType;
@@ -439,15 +506,16 @@ Matrix<typename F::ElemType> operator*(const F &lhs, const S &rhs) {
 
     assert(lhs.Columns() == rhs.Rows() && "Matrix multiplication mismatch.");
 
+    using W = Utils::WideType<T>;
     Matrix<T> result(lhs.Rows(), rhs.Columns());
 
     for (IndexType i = 0; i < lhs.Rows(); ++i) {
         for (IndexType j = 0; j < rhs.Columns(); ++j) {
-            T sum = 0;
+            W sum = 0;
             for (IndexType k = 0; k < lhs.Columns(); ++k) {
-                sum += lhs(i, k) * rhs(k, j);
+                sum += static_cast<W>(lhs(i, k)) * static_cast<W>(rhs(k, j));
             }
-            result(i, j) = sum;
+            result(i, j) = static_cast<T>(sum);
         }
     }
 
@@ -509,6 +577,18 @@ F &operator*=(F &lhs, typename F::ElemType scalar) {
     return lhs;
 }
 
+template <Utils::FloatOrComplex T>
+Matrix<T> operator*(Matrix<T> &&lhs, std::type_identity_t<T> scalar) {
+    lhs *= scalar;
+    return std::move(lhs);
+}
+
+template <Utils::FloatOrComplex T>
+Matrix<T> operator*(std::type_identity_t<T> scalar, Matrix<T> &&rhs) {
+    rhs *= scalar;
+    return std::move(rhs);
+}
+
 template <MatrixUtils::MatrixType F>
 Matrix<typename F::ElemType> operator/(const F &lhs,
                                        typename F::ElemType scalar) {
@@ -543,6 +623,12 @@ F &operator/=(F &lhs, typename F::ElemType scalar) {
     return lhs;
 }
 
+template <Utils::FloatOrComplex T>
+Matrix<T> operator/(Matrix<T> &&lhs, std::type_identity_t<T> scalar) {
+    lhs /= scalar;
+    return std::move(lhs);
+}
+
 template <MatrixUtils::MatrixType F, MatrixUtils::MatrixType S>
 bool operator==(const F &lhs, const S &rhs) {
     if (lhs.Rows() != rhs.Rows() || lhs.Columns() != rhs.Columns()) {
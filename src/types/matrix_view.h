@@ -199,6 +199,10 @@ public:
                                   {column_.begin, column_.end}, state_);
     }
 
+    const T *GetAddress(IndexType row_idx, IndexType col_idx) const {
+        return ConstView().GetAddress(row_idx, col_idx);
+    }
+
     MatrixView GetRow(IndexType index) {
         assert(ptr_ != nullptr && "Matrix pointer is null.");
         assert(index < Rows() &&
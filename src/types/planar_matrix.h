@@ -0,0 +1,99 @@
+#pragma once
+
+#include "matrix.h"
+
+#include <complex>
+#include <vector>
+
+namespace LinearKit {
+// Complex matrix with the real and the imaginary parts in separate row-major
+// arrays. The kernels over it are loops over plain real arrays, which the
+// compiler vectorizes as for real matrices, instead of std::complex
+// multiplication with its NaN and infinity handling.
+template <Utils::Details::FloatingPoint T>
+class PlanarMatrix {
+    using IndexType = Details::Types::IndexType;
+
+public:
+    using ElemType = std::complex<T>;
+
+    PlanarMatrix() = default;
+
+    PlanarMatrix(IndexType row_cnt, IndexType col_cnt)
+        : rows_(std::max(IndexType{0}, row_cnt)),
+          cols_(std::max(IndexType{0}, col_cnt)), real_(rows_ * cols_),
+          imag_(rows_ * cols_) {
+    }
+
+    template <MatrixUtils::MatrixType M>
+    explicit PlanarMatrix(const M &rhs)
+        : PlanarMatrix(rhs.Rows(), rhs.Columns()) {
+        for (IndexType i = 0; i < rows_; ++i) {
+            for (IndexType j = 0; j < cols_; ++j) {
+                auto value = ElemType(rhs(i, j));
+                real_[i * cols_ + j] = value.real();
+                imag_[i * cols_ + j] = value.imag();
+            }
+        }
+    }
+
+    ElemType operator()(IndexType row_idx, IndexType col_idx) const {
+        assert(row_idx < rows_ && col_idx < cols_ &&
+               "Requested indexes are outside the matrix boundaries.");
+        return {real_[row_idx * cols_ + col_idx],
+                imag_[row_idx * cols_ + col_idx]};
+    }
+
+    void Set(IndexType row_idx, IndexType col_idx, ElemType value) {
+        assert(row_idx < rows_ && col_idx < cols_ &&
+               "Requested indexes are outside the matrix boundaries.");
+        real_[row_idx * cols_ + col_idx] = value.real();
+        imag_[row_idx * cols_ + col_idx] = value.imag();
+    }
+
+    [[nodiscard]] IndexType Rows() const {
+        return rows_;
+    }
+
+    [[nodiscard]] IndexType Columns() const {
+        return cols_;
+    }
+
+    T *RealRow(IndexType row_idx) {
+        return real_.data() + row_idx * cols_;
+    }
+
+    T *ImagRow(IndexType row_idx) {
+        return imag_.data() + row_idx * cols_;
+    }
+
+    const T *RealRow(IndexType row_idx) const {
+        return real_.data() + row_idx * cols_;
+    }
+
+    const T *ImagRow(IndexType row_idx) const {
+        return imag_.data() + row_idx * cols_;
+    }
+
+    Matrix<ElemType> ToMatrix() const {
+        Matrix<ElemType> result(rows_, cols_);
+        for (IndexType i = 0; i < rows_; ++i) {
+            for (IndexType j = 0; j < cols_; ++j) {
+                result(i, j) = (*this)(i, j);
+            }
+        }
+
+        return result;
+    }
+
+private:
+    IndexType rows_ = 0;
+    IndexType cols_ = 0;
+    std::vector<T> real_;
+    std::vector<T> imag_;
+};
+
+template <MatrixUtils::MatrixType M>
+PlanarMatrix(const M &)
+    -> PlanarMatrix<Utils::RealType<typename M::ElemType>>;
+} // namespace LinearKit
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "../utils/sign.h"
+#include "types_details.h"
+
+#include <algorithm>
+
+namespace LinearKit::Details {
+// Register tiles are kTransposeTileSize x kTransposeTileSize, so the loops
+// over them have constant bounds and the compiler unrolls them into
+// shuffles. Cache blocks of kTransposeBlockSize rows and columns keep both
+// the source and the destination lines resident.
+inline constexpr Types::IndexType kTransposeTileSize = 8;
+inline constexpr Types::IndexType kTransposeBlockSize = 64;
+
+template <bool kConjugate, Utils::FloatOrComplex T>
+T ConjugateIf(T value) {
+    if constexpr (kConjugate) {
+        return Utils::Conj(value);
+    } else {
+        return value;
+    }
+}
+
+// dst = src^T (or src^H) for src with rows x cols entries in row-major
+// order; dst has cols x rows entries.
+template <bool kConjugate, Utils::FloatOrComplex T>
+void TransposeTiled(const T *src, T *dst, Types::IndexType rows,
+                    Types::IndexType cols) {
+    using IndexType = Types::IndexType;
+    constexpr auto kTile = kTransposeTileSize;
+    constexpr auto kBlock = kTransposeBlockSize;
+
+    for (IndexType ib = 0; ib < rows; ib += kBlock) {
+        auto i_to = std::min(rows, ib + kBlock);
+        for (IndexType jb = 0; jb < cols; jb += kBlock) {
+            auto j_to = std::min(cols, jb + kBlock);
+
+            for (IndexType i = ib; i < i_to; i += kTile) {
+                for (IndexType j = jb; j < j_to; j += kTile) {
+                    if (i + kTile <= i_to && j + kTile <= j_to) {
+                        T tile[kTile][kTile];
+                        for (IndexType r = 0; r < kTile; ++r) {
+                            for (IndexType c = 0; c < kTile; ++c) {
+                                tile[c][r] = ConjugateIf<kConjugate>(
+                                    src[(i + r) * cols + j + c]);
+                            }
+                        }
+                        for (IndexType c = 0; c < kTile; ++c) {
+                            for (IndexType r = 0; r < kTile; ++r) {
+                                dst[(j + c) * rows + i + r] = tile[c][r];
+                            }
+                        }
+                        continue;
+                    }
+
+                    for (IndexType r = i; r < std::min(i_to, i + kTile); ++r) {
+                        for (IndexType c = j; c < std::min(j_to, j + kTile);
+                             ++c) {
+                            dst[c * rows + r] =
+                                ConjugateIf<kConjugate>(src[r * cols + c]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+// In-place transpose of a square size x size matrix: the tiles above the
+// diagonal are swapped with the mirrored ones below it, and the diagonal
+// tiles are transposed in place.
+template <bool kConjugate, Utils::FloatOrComplex T>
+void TransposeSquareInPlace(T *data, Types::IndexType size) {
+    using IndexType = Types::IndexType;
+    constexpr auto kTile = kTransposeTileSize;
+
+    for (IndexType i = 0; i < size; i += kTile) {
+        auto i_to = std::min(size, i + kTile);
+
+        for (IndexType r = i; r < i_to; ++r) {
+            data[r * size + r] = ConjugateIf<kConjugate>(data[r * size + r]);
+            for (IndexType c = r + 1; c < i_to; ++c) {
+                auto upper = data[r * size + c];
+                data[r * size + c] =
+                    ConjugateIf<kConjugate>(data[c * size + r]);
+                data[c * size + r] = ConjugateIf<kConjugate>(upper);
+            }
+        }
+
+        for (IndexType j = i_to; j < size; j += kTile) {
+            auto j_to = std::min(size, j + kTile);
+
+            if (i_to - i == kTile && j_to - j == kTile) {
+                T upper[kTile][kTile];
+                T lower[kTile][kTile];
+                for (IndexType r = 0; r < kTile; ++r) {
+                    for (IndexType c = 0; c < kTile; ++c) {
+                        upper[c][r] = ConjugateIf<kConjugate>(
+                            data[(i + r) * size + j + c]);
+                        lower[c][r] = ConjugateIf<kConjugate>(
+                            data[(j + r) * size + i + c]);
+                    }
+                }
+                for (IndexType r = 0; r < kTile; ++r) {
+                    for (IndexType c = 0; c < kTile; ++c) {
+                        data[(i + r) * size + j + c] = lower[r][c];
+                        data[(j + r) * size + i + c] = upper[r][c];
+                    }
+                }
+                continue;
+            }
+
+            for (IndexType r = i; r < i_to; ++r) {
+                for (IndexType c = j; c < j_to; ++c) {
+                    auto upper = data[r * size + c];
+                    data[r * size + c] =
+                        ConjugateIf<kConjugate>(data[c * size + r]);
+                    data[c * size + r] = ConjugateIf<kConjugate>(upper);
+                }
+            }
+        }
+    }
+}
+} // namespace LinearKit::Details
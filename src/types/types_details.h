@@ -8,19 +8,13 @@
 #include <utility>
 
 namespace LinearKit {
-template <Utils::FloatOrComplex T>
-class Matrix;
-
-template <Utils::FloatOrComplex T>
-class MatrixView;
-
-template <Utils::FloatOrComplex T>
-class ConstMatrixView;
-
 namespace Details {
 struct Types {
     using IndexType = std::ptrdiff_t;
 
+    // The size of a matrix known only at runtime.
+    static constexpr IndexType kDynamic = -1;
+
     template <Utils::FloatOrComplex T>
     using Function = std::function<void(T &)>;
 
@@ -59,4 +53,17 @@ struct Types {
     }
 };
 } // namespace Details
+
+// Matrix<T> has runtime sizes and heap storage, Matrix<T, Rows, Cols> has
+// both sizes fixed at compile time and inline storage.
+template <Utils::FloatOrComplex T = long double,
+          Details::Types::IndexType Rows = Details::Types::kDynamic,
+          Details::Types::IndexType Cols = Details::Types::kDynamic>
+class Matrix;
+
+template <Utils::FloatOrComplex T>
+class MatrixView;
+
+template <Utils::FloatOrComplex T>
+class ConstMatrixView;
 } // namespace LinearKit
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "is_float_complex.h"
+#include "math_functions.h"
 
 #include <cmath>
 #include <limits>
@@ -42,7 +43,7 @@ bool AreEqualFloating(T lhs, T rhs, T eps = T{0}) {
         auto is_equal_imag = std::abs(lhs.imag() - rhs.imag()) < eps.real();
         return is_equal_real && is_equal_imag;
     } else {
-        return std::abs(lhs - rhs) < eps;
+        return Abs(lhs - rhs) < eps;
     }
 }
 
@@ -5,17 +5,57 @@
 
 namespace LinearKit::Utils {
 namespace Details {
+// Specialized for the floating types of the library, such as DoubleDouble.
 template <typename T>
-concept FloatingPoint = std::is_floating_point_v<T>;
+struct IsExtendedFloatT : std::false_type {};
+
+template <typename T>
+concept FloatingPoint =
+    std::is_floating_point_v<T> || IsExtendedFloatT<T>::value;
 
 template <typename T>
 struct IsFloatComplexT : std::false_type {};
 
+// std::complex is specified for the standard floating types only.
 template <FloatingPoint T>
+    requires std::is_floating_point_v<T>
 struct IsFloatComplexT<std::complex<T>> : std::true_type {};
+
+template <typename T>
+struct RealT {
+    using Type = T;
+};
+
+template <FloatingPoint T>
+struct RealT<std::complex<T>> {
+    using Type = T;
+};
+
+// The type in which the kernels accumulate values stored as T.
+template <typename T>
+struct WideT {
+    using Type = T;
+};
 } // namespace Details
 
 template <typename T>
 concept FloatOrComplex = Details::FloatingPoint<std::remove_cv_t<T>> ||
                          Details::IsFloatComplexT<std::remove_cv_t<T>>::value;
+
+template <FloatOrComplex T>
+using RealType = typename Details::RealT<std::remove_cv_t<T>>::Type;
+
+template <FloatOrComplex T>
+using WideType = typename Details::WideT<std::remove_cv_t<T>>::Type;
+
+// The standard floating types and their complex types. The engines still
+// built on the std math functions take only these.
+template <typename T>
+concept StandardFloatOrComplex =
+    FloatOrComplex<T> && std::is_floating_point_v<RealType<T>>;
+
+// Types only stored in the matrices, with the arithmetic done in WideType.
+template <typename T>
+concept StorageFloat =
+    FloatOrComplex<T> && !std::is_same_v<std::remove_cv_t<T>, WideType<T>>;
 } // namespace LinearKit::Utils
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "is_float_complex.h"
+
+#include <cmath>
+
+namespace LinearKit::Utils {
+// Unlike std::abs and std::sqrt, also find the overloads for the extended
+// floating types by argument-dependent lookup.
+template <FloatOrComplex T>
+RealType<T> Abs(T value) {
+    using std::abs;
+    return abs(value);
+}
+
+template <FloatOrComplex T>
+T Sqrt(T value) {
+    using std::sqrt;
+    return sqrt(value);
+}
+
+// As std::real and std::imag, without promoting real arguments to complex.
+template <FloatOrComplex T>
+RealType<T> Real(T value) {
+    if constexpr (Details::IsFloatComplexT<T>::value) {
+        return value.real();
+    } else {
+        return value;
+    }
+}
+
+template <FloatOrComplex T>
+RealType<T> Imag(T value) {
+    if constexpr (Details::IsFloatComplexT<T>::value) {
+        return value.imag();
+    } else {
+        return RealType<T>{0};
+    }
+}
+
+// The squared absolute value, as std::norm.
+template <FloatOrComplex T>
+RealType<T> Norm(T value) {
+    if constexpr (Details::IsFloatComplexT<T>::value) {
+        return std::norm(value);
+    } else {
+        return value * value;
+    }
+}
+} // namespace LinearKit::Utils
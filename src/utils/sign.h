@@ -15,4 +15,14 @@ T Sign(T value) {
         return (value >= T{0}) ? T{1} : T{-1};
     }
 }
+
+// Unlike std::conj, keeps real arguments real.
+template <Utils::FloatOrComplex T = long double>
+T Conj(T value) {
+    if constexpr (Utils::Details::IsFloatComplexT<T>::value) {
+        return std::conj(value);
+    } else {
+        return value;
+    }
+}
 } // namespace LinearKit::Utils
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace LinearKit::Utils {
+class ThreadPool {
+    using Task = std::function<void()>;
+
+public:
+    explicit ThreadPool(std::size_t worker_cnt) {
+        workers_.reserve(worker_cnt);
+        for (std::size_t i = 0; i < worker_cnt; ++i) {
+            workers_.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool &rhs) = delete;
+    ThreadPool &operator=(const ThreadPool &rhs) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(mutex_);
+            is_stopped_ = true;
+        }
+
+        cv_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+    }
+
+    static ThreadPool &Instance() {
+        static ThreadPool pool(
+            std::max(std::thread::hardware_concurrency(), 1u) - 1);
+        return pool;
+    }
+
+    [[nodiscard]] std::size_t Concurrency() const {
+        return workers_.size() + 1;
+    }
+
+    void Submit(Task task) {
+        {
+            std::lock_guard lock(mutex_);
+            tasks_.push(std::move(task));
+        }
+
+        cv_.notify_one();
+    }
+
+    bool RunPendingTask() {
+        Task task;
+        {
+            std::lock_guard lock(mutex_);
+            if (tasks_.empty()) {
+                return false;
+            }
+
+            task = std::move(tasks_.front());
+            tasks_.pop();
+        }
+
+        task();
+        return true;
+    }
+
+private:
+    void WorkerLoop() {
+        while (true) {
+            Task task;
+            {
+                std::unique_lock lock(mutex_);
+                cv_.wait(lock, [&] { return is_stopped_ || !tasks_.empty(); });
+
+                if (tasks_.empty()) {
+                    return;
+                }
+
+                task = std::move(tasks_.front());
+                tasks_.pop();
+            }
+
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::queue<Task> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool is_stopped_ = false;
+};
+
+template <typename Func>
+void ParallelFor(std::ptrdiff_t begin, std::ptrdiff_t end, Func &&func,
+                 std::ptrdiff_t grain = 1) {
+    auto &pool = ThreadPool::Instance();
+    auto count = end - begin;
+
+    if (count <= 0) {
+        return;
+    }
+
+    grain = std::max(grain, std::ptrdiff_t{1});
+    auto chunk_cnt = std::min<std::ptrdiff_t>(
+        static_cast<std::ptrdiff_t>(pool.Concurrency()),
+        (count + grain - 1) / grain);
+
+    if (chunk_cnt <= 1) {
+        for (auto i = begin; i < end; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    auto chunk = (count + chunk_cnt - 1) / chunk_cnt;
+    std::atomic<std::ptrdiff_t> remaining = chunk_cnt - 1;
+
+    for (std::ptrdiff_t c = 1; c < chunk_cnt; ++c) {
+        auto from = begin + c * chunk;
+        auto to = std::min(end, from + chunk);
+
+        pool.Submit([&, from, to] {
+            for (auto i = from; i < to; ++i) {
+                func(i);
+            }
+            remaining.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    for (auto i = begin; i < std::min(end, begin + chunk); ++i) {
+        func(i);
+    }
+
+    // Helping with queued work instead of blocking keeps nested calls safe.
+    while (remaining.load(std::memory_order_acquire) > 0) {
+        if (!pool.RunPendingTask()) {
+            std::this_thread::yield();
+        }
+    }
+}
+} // namespace LinearKit::Utils
@@ -2,6 +2,7 @@
 
 #include "../src/types/matrix.h"
 
+#include <algorithm>
 #include <random>
 
 namespace LinearKit::Tests {
@@ -51,6 +52,45 @@ public:
         return result;
     }
 
+    // Upper bidiagonal with the diagonal scaled by diag_scale, the entries
+    // from -1 to 1.
+    Matrix<T> GetBidiagonal(int32_t size, T diag_scale = T{1}) {
+        Matrix<T> result(size);
+        for (IndexType i = 0; i < size; ++i) {
+            result(i, i) = diag_scale * GetRandomTypeNumber() / T{kNumberTo};
+            if (i + 1 < size) {
+                result(i, i + 1) = GetRandomTypeNumber() / T{kNumberTo};
+            }
+        }
+        return result;
+    }
+
+    // Small entries with 3 added to the diagonal.
+    Matrix<T> GetWellConditioned(int32_t rows, int32_t cols) {
+        auto result = GetMatrix(rows, cols) / T{kNumberTo};
+        for (IndexType i = 0; i < std::min(rows, cols); ++i) {
+            result(i, i) += T{3};
+        }
+        return result;
+    }
+
+    // Rank k matrix with small entries.
+    Matrix<T> GetLowRank(int32_t rows, int32_t cols, int32_t rank) {
+        auto left = GetMatrix(rows, rank) / T{kNumberTo};
+        auto right = GetMatrix(rank, cols) / T{kNumberTo};
+
+        Matrix<T> result(rows, cols);
+        for (IndexType i = 0; i < rows; ++i) {
+            for (IndexType k = 0; k < rank; ++k) {
+                for (IndexType j = 0; j < cols; ++j) {
+                    result(i, j) += left(i, k) * right(k, j);
+                }
+            }
+        }
+
+        return result;
+    }
+
 private:
     static constexpr int32_t kMatrixMinSize = 0;
     static constexpr int32_t kMatrixMaxSize = 100;
@@ -61,4 +101,20 @@ private:
     IntDistribution rd_number_;
     IntDistribution rd_matrix_size_;
 };
+
+// The largest entry of U^H * U - I. IsUnitary checks only the column norms.
+template <typename T>
+long double GetOrthogonalityError(const Matrix<T> &U) {
+    auto gram = Matrix<T>::Conjugated(U) * U;
+
+    long double error = 0;
+    for (IndexType i = 0; i < gram.Rows(); ++i) {
+        for (IndexType j = 0; j < gram.Columns(); ++j) {
+            auto diff = gram(i, j) - ((i == j) ? T{1} : T{0});
+            error = std::max(error, static_cast<long double>(std::abs(diff)));
+        }
+    }
+
+    return error;
+}
 } // namespace LinearKit::Tests
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/batched.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+template <typename T>
+MatrixBatch<T> GetBatch(RandomGenerator<T> &gen, IndexType count,
+                        IndexType rows, IndexType cols) {
+    MatrixBatch<T> batch(count, rows, cols);
+    for (IndexType b = 0; b < count; ++b) {
+        batch.Set(b, gen.GetMatrix(rows, cols) / T{100});
+    }
+
+    return batch;
+}
+
+template <typename T>
+MatrixBatch<T> GetHermitianBatch(RandomGenerator<T> &gen, IndexType count,
+                                 IndexType size) {
+    auto batch = GetBatch(gen, count, size, size);
+    for (IndexType b = 0; b < count; ++b) {
+        for (IndexType i = 0; i < size; ++i) {
+            batch(b, i, i) = std::real(batch(b, i, i));
+            for (IndexType j = 0; j < i; ++j) {
+                batch(b, j, i) = Conj(batch(b, i, j));
+            }
+        }
+    }
+
+    return batch;
+}
+
+template <typename T>
+void CheckBatchedQR(const MatrixBatch<T> &batch) {
+    auto [Q, R] = BatchedQR(batch);
+    for (IndexType b = 0; b < batch.Count(); ++b) {
+        auto q = Q.Get(b);
+        auto r = R.Get(b);
+        EXPECT_TRUE(IsUnitary(q));
+        EXPECT_TRUE(IsUpperTriangular(r));
+        EXPECT_TRUE(AreEqualMatrices(batch.Get(b), q * r));
+    }
+}
+
+template <typename T>
+void CheckBatchedSVD(const MatrixBatch<T> &batch) {
+    auto [U, S, VT] = BatchedSVD(batch);
+    auto rows = batch.Rows();
+    auto cols = batch.Columns();
+    ASSERT_EQ(S.Columns(), std::min(rows, cols));
+
+    for (IndexType b = 0; b < batch.Count(); ++b) {
+        auto u = U.Get(b);
+        auto vt = VT.Get(b);
+        EXPECT_TRUE(IsUnitary(u));
+        EXPECT_TRUE(IsUnitary(vt));
+
+        Matrix<T> sigma(rows, cols);
+        for (IndexType i = 0; i < S.Columns(); ++i) {
+            sigma(i, i) = S(b, 0, i);
+            EXPECT_GE(std::real(S(b, 0, i)), 0);
+            if (i > 0) {
+                EXPECT_GE(std::real(S(b, 0, i - 1)), std::real(S(b, 0, i)));
+            }
+        }
+        EXPECT_TRUE(AreEqualMatrices(batch.Get(b), u * sigma * vt));
+    }
+}
+
+template <typename T>
+void CheckBatchedSpec(const MatrixBatch<T> &batch) {
+    auto [D, U] = BatchedSpec(batch);
+    for (IndexType b = 0; b < batch.Count(); ++b) {
+        auto u = U.Get(b);
+        auto d = D.Get(b);
+        EXPECT_TRUE(IsUnitary(u));
+        EXPECT_TRUE(IsDiagonal(d));
+        EXPECT_TRUE(AreEqualMatrices(batch.Get(b),
+                                     u * d * Matrix<T>::Conjugated(u)));
+    }
+}
+
+TEST(TEST_BATCHED, BatchLayout) {
+    std::vector<double> buffer = {1, 2, 3, 4, -1, 5, 6, 7, 8, -1};
+
+    MatrixBatch<double> batch(buffer.data(), 2, 2, 2, 5);
+    EXPECT_EQ(batch.Count(), 2);
+    EXPECT_TRUE(AreEqualMatrices(batch.Get(0), Matrix<double>{{1, 2}, {3, 4}}));
+    EXPECT_TRUE(AreEqualMatrices(batch.Get(1), Matrix<double>{{5, 6}, {7, 8}}));
+    EXPECT_EQ(batch.Lanes(1, 0)[1], 7);
+
+    std::vector<double> copy(10, -1);
+    batch.CopyTo(copy.data(), 5);
+    EXPECT_EQ(copy, buffer);
+
+    std::vector<Matrix<double>> matrices = {batch.Get(1), batch.Get(0)};
+    MatrixBatch<double> swapped(matrices);
+    EXPECT_TRUE(AreEqualMatrices(swapped.Get(0), batch.Get(1)));
+}
+
+TEST(TEST_BATCHED, BatchedQRSmall) {
+    MatrixBatch<long double> batch(2, 3, 2);
+    batch.Set(0, Matrix<>{{1, 2}, {3, 4}, {5, 6}});
+    batch.Set(1, Matrix<>{{0, 1}, {0, 0}, {0, 2}});
+
+    CheckBatchedQR(batch);
+}
+
+TEST(TEST_BATCHED, BatchedQRShapes) {
+    RandomGenerator<double> gen(2);
+    for (auto [rows, cols] : {std::pair{3, 3}, {8, 8}, {6, 3}, {3, 7}}) {
+        CheckBatchedQR(GetBatch(gen, 150, rows, cols));
+    }
+}
+
+TEST(TEST_BATCHED, BatchedQRComplex) {
+    RandomGenerator<Complex<double>> gen(3);
+    CheckBatchedQR(GetBatch(gen, 70, 5, 4));
+}
+
+TEST(TEST_BATCHED, BatchedSVDSmall) {
+    MatrixBatch<long double> batch(3, 3, 3);
+    batch.Set(0, Matrix<>{{1, 2, 3}, {4, 5, 6}, {7, 8, 10}});
+    batch.Set(1, Matrix<>{{0, 0, 0}, {0, 0, 0}, {0, 0, 0}});
+    batch.Set(2, Matrix<>{{0, 0, 0}, {0, 2, 0}, {1, 0, 0}});
+
+    CheckBatchedSVD(batch);
+    auto [U, S, VT] = BatchedSVD(batch);
+    EXPECT_TRUE(AreEqualFloating(S(2, 0, 0), 2.l));
+    EXPECT_TRUE(AreEqualFloating(S(2, 0, 1), 1.l));
+    EXPECT_TRUE(AreEqualFloating(S(2, 0, 2), 0.l));
+}
+
+TEST(TEST_BATCHED, BatchedSVDShapes) {
+    RandomGenerator<double> gen(4);
+    for (auto [rows, cols] : {std::pair{3, 3}, {8, 8}, {7, 4}, {2, 6}}) {
+        CheckBatchedSVD(GetBatch(gen, 130, rows, cols));
+    }
+}
+
+TEST(TEST_BATCHED, BatchedSVDComplex) {
+    RandomGenerator<Complex<double>> gen(5);
+    CheckBatchedSVD(GetBatch(gen, 65, 4, 5));
+}
+
+TEST(TEST_BATCHED, BatchedSpecReal) {
+    RandomGenerator<double> gen(6);
+    for (IndexType size : {1, 3, 6, 8}) {
+        CheckBatchedSpec(GetHermitianBatch(gen, 100, size));
+    }
+}
+
+TEST(TEST_BATCHED, BatchedSpecComplex) {
+    RandomGenerator<Complex<double>> gen(7);
+    CheckBatchedSpec(GetHermitianBatch(gen, 40, 5));
+}
+
+TEST(TEST_BATCHED, BatchedEmpty) {
+    MatrixBatch<double> batch(0, 3, 3);
+    auto [Q, R] = BatchedQR(batch);
+    EXPECT_EQ(Q.Count(), 0);
+
+    auto [U, S, VT] = BatchedSVD(batch);
+    EXPECT_EQ(S.Count(), 0);
+}
+
+TEST(TEST_BATCHED, Stress) {
+    using Type = double;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 6; ++seed) {
+        MatrixGenerator gen(seed);
+
+        int32_t count = gen.GetMatrixSize() * 3 + 1;
+        int32_t rows = gen.GetMatrixSize() % 8 + 1;
+        int32_t cols = gen.GetMatrixSize() % 8 + 1;
+
+        CheckBatchedQR(GetBatch(gen, count, rows, cols));
+        CheckBatchedSVD(GetBatch(gen, count, rows, cols));
+        CheckBatchedSpec(GetHermitianBatch(gen, count, rows));
+    }
+}
+} // namespace
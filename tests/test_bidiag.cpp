@@ -10,6 +10,7 @@ using Complex = std::complex<T>;
 
 template <typename T = long double>
 using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
 
 using namespace LinearKit::Algorithm;
 using namespace LinearKit::Utils;
@@ -80,6 +81,55 @@ TEST(TEST_BIDIAG, BidiagView) {
     CheckBidiag(view, U, B, VT);
 }
 
+TEST(TEST_BIDIAG, BlockedSquare) {
+    using Matrix = Matrix<long double>;
+
+    Matrix matrix = {
+        {1, 2, 2, 4}, {6, 6, 7, 8}, {9, 10, 11, 11}, {12, 13, 14, 17}};
+
+    for (IndexType block = 1; block <= 5; ++block) {
+        auto [U, B, VT] = BlockedBidiagonalize(matrix, block);
+        CheckBidiag(matrix, U, B, VT);
+    }
+}
+
+TEST(TEST_BIDIAG, BlockedRectangle) {
+    RandomGenerator<long double> gen(2024);
+
+    for (auto [rows, cols] : {std::pair{1, 6}, {6, 1}, {17, 9}, {9, 17}}) {
+        auto matrix = gen.GetMatrix(rows, cols);
+        auto [U, B, VT] = BlockedBidiagonalize(matrix, 4);
+        CheckBidiag(matrix, U, B, VT);
+    }
+}
+
+TEST(TEST_BIDIAG, BlockedComplex) {
+    using Matrix = Matrix<Complex<long double>>;
+
+    Matrix matrix = {{{1, 2}, {3, 4}, {-1, 2}}, {{7, -3}, {-3, 2}, {-5, -3}}};
+
+    auto [U, B, VT] = BlockedBidiagonalize(matrix, 1);
+    CheckBidiag(matrix, U, B, VT);
+
+    B.ForEach([](const auto &val) { EXPECT_EQ(val.imag(), 0.l); });
+}
+
+TEST(TEST_BIDIAG, BlockedStress) {
+    using Type = Complex<long double>;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 5; ++seed) {
+        MatrixGenerator gen(seed);
+
+        int32_t rows = gen.GetMatrixSize();
+        int32_t columns = gen.GetMatrixSize();
+
+        auto matrix = gen.GetMatrix(rows, columns);
+        auto [U, B, VT] = BlockedBidiagonalize(matrix, 8);
+        CheckBidiag(matrix, U, B, VT);
+    }
+}
+
 TEST(TEST_BIDIAG, Stress) {
     using Type = Complex<long double>;
     using MatrixGenerator = RandomGenerator<Type>;
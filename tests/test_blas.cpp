@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/blas.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+TEST(TEST_BLAS, Gemm) {
+    using Type = Complex<long double>;
+    RandomGenerator<Type> gen(41);
+    Type alpha{2, -1};
+    Type beta{0.5, 0.25};
+
+    for (auto [rows, inner, cols] :
+         {std::tuple{1, 1, 1}, {4, 7, 3}, {33, 20, 45}}) {
+        auto A = gen.GetMatrix(inner, rows) / Type{100};
+        auto B = gen.GetMatrix(inner, cols) / Type{100};
+        auto C = gen.GetMatrix(rows + 2, cols + 1) / Type{100};
+
+        auto A_adjoint = Matrix<Type>::Conjugated(A);
+        auto product = A_adjoint * B;
+        auto expected = C;
+        for (IndexType i = 0; i < rows; ++i) {
+            for (IndexType j = 0; j < cols; ++j) {
+                expected(i + 1, j) = alpha * product(i, j) + beta * C(i + 1, j);
+            }
+        }
+
+        Gemm(alpha, A_adjoint, B, beta,
+             C.GetSubmatrix({1, rows + 1}, {0, cols}));
+        EXPECT_TRUE(AreEqualMatrices(C, expected));
+    }
+}
+
+TEST(TEST_BLAS, GemmTransposedOutput) {
+    RandomGenerator<double> gen(43);
+    auto A = gen.GetMatrix(6, 5) / 100.0;
+    auto B = gen.GetMatrix(5, 4) / 100.0;
+
+    // beta == 0 does not read C, so NaN there is overwritten.
+    Matrix<double> C(4, 6);
+    C.ApplyForEach([](double &value) {
+        value = std::numeric_limits<double>::quiet_NaN();
+    });
+
+    Gemm(1.0, A, B, 0.0, Matrix<double>::Transposed(C));
+    EXPECT_TRUE(AreEqualMatrices(C, Matrix<double>::Transposed(A * B)));
+}
+
+TEST(TEST_BLAS, MatrixOutput) {
+    RandomGenerator<double> gen(44);
+    auto A = gen.GetMatrix(6, 5) / 100.0;
+    auto B = gen.GetMatrix(5, 4) / 100.0;
+    auto x = gen.GetMatrix(5, 1) / 100.0;
+
+    // The output is a Matrix, the integer scalars convert to its type.
+    Matrix<double> C(6, 4);
+    Gemm(1, A, B, 0, C);
+    EXPECT_TRUE(AreEqualMatrices(C, A * B));
+
+    Matrix<double> y(6, 1);
+    Gemv(2.0, A, x, 0.0, y);
+    EXPECT_TRUE(AreEqualMatrices(y, 2.0 * (A * x)));
+
+    Axpy(-1, Matrix<double>(2.0 * (A * x)), y);
+    EXPECT_TRUE(AreEqualMatrices(y, Matrix<double>(6, 1)));
+}
+
+TEST(TEST_BLAS, GemmAliasing) {
+    RandomGenerator<double> gen(45);
+    auto C = gen.GetMatrix(8, 8) / 100.0;
+    auto B = gen.GetMatrix(4, 4) / 100.0;
+
+    // A is C itself: every row is read before it is written.
+    auto left = C.GetSubmatrix({0, 8}, {0, 4});
+    auto expected = Matrix<double>(left) * B;
+    Gemm(1.0, left, B, 0.0, left);
+    EXPECT_TRUE(AreEqualMatrices(Matrix<double>(left), expected));
+
+    using LinearKit::Algorithm::Details::IsSameOrDisjoint;
+    auto right = C.GetSubmatrix({0, 8}, {4, 8});
+    auto shifted = C.GetSubmatrix({0, 8}, {2, 6});
+    EXPECT_TRUE(IsSameOrDisjoint(left, left, true));
+    EXPECT_FALSE(IsSameOrDisjoint(left, left, false));
+    EXPECT_TRUE(IsSameOrDisjoint(right, left, false));
+    EXPECT_TRUE(IsSameOrDisjoint(B, left, false));
+    EXPECT_FALSE(IsSameOrDisjoint(shifted, left, true));
+    EXPECT_FALSE(IsSameOrDisjoint(
+        Matrix<double>::Transposed(C).GetSubmatrix({0, 4}, {0, 4}),
+        C.GetSubmatrix({0, 4}, {0, 4}), true));
+}
+
+TEST(TEST_BLAS, Level2) {
+    using Type = Complex<double>;
+    RandomGenerator<Type> gen(47);
+    auto A = gen.GetMatrix(9, 6) / Type{100};
+    auto x = gen.GetMatrix(6, 1) / Type{100};
+    auto y = gen.GetMatrix(9, 1) / Type{100};
+
+    auto expected = Type{3} * (A * x) - y;
+    Gemv(Type{3}, A, x, Type{-1}, y.View());
+    EXPECT_TRUE(AreEqualMatrices(y, expected));
+
+    auto outer = A + Type{0, 2} * (y * Matrix<Type>::Conjugated(x));
+    Ger(Type{0, 2}, y, x, A.View());
+    EXPECT_TRUE(AreEqualMatrices(A, outer));
+
+    auto sum = y + Type{-2} * expected;
+    Axpy(Type{-2}, expected, y.View());
+    EXPECT_TRUE(AreEqualMatrices(y, sum));
+}
+} // namespace
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/cholesky.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+template <typename T>
+Matrix<T> GetPositiveDefinite(RandomGenerator<T> &gen, IndexType size) {
+    // Entries of B are scaled to [-1, 1] to keep the absolute error small.
+    auto B = gen.GetMatrix(size, size) / T{100};
+    return B * Matrix<T>::Conjugated(B) +
+           Matrix<T>::Identity(size) * T(static_cast<double>(size));
+}
+
+template <MatrixType M, MatrixType F>
+void CheckCholesky(const M &matrix, const F &L) {
+    using T = typename M::ElemType;
+
+    EXPECT_TRUE(IsUpperTriangular(Matrix<T>::Transposed(L)));
+    EXPECT_TRUE(AreEqualMatrices(matrix, L * Matrix<T>::Conjugated(L)));
+}
+
+TEST(TEST_CHOLESKY, CholeskyClear) {
+    Matrix<> matrix;
+
+    auto factor = Cholesky(matrix);
+    EXPECT_TRUE(factor.IsPositiveDefinite());
+}
+
+TEST(TEST_CHOLESKY, CholeskyReal) {
+    Matrix<> matrix = {{4, 12, -16}, {12, 37, -43}, {-16, -43, 98}};
+
+    auto factor = Cholesky(matrix, 2);
+    ASSERT_TRUE(factor.IsPositiveDefinite());
+
+    auto L = factor.GetL();
+    CheckCholesky(matrix, L);
+    EXPECT_TRUE(
+        AreEqualMatrices(L, Matrix<>{{2, 0, 0}, {6, 1, 0}, {-8, 5, 3}}));
+}
+
+TEST(TEST_CHOLESKY, CholeskyComplex) {
+    Matrix<Complex<>> matrix = {{{4, 0}, {2, 2}, {0, -2}},
+                                {{2, -2}, {6, 0}, {1, 1}},
+                                {{0, 2}, {1, -1}, {5, 0}}};
+
+    auto factor = Cholesky(matrix, 1);
+    ASSERT_TRUE(factor.IsPositiveDefinite());
+    CheckCholesky(matrix, factor.GetL());
+}
+
+TEST(TEST_CHOLESKY, CholeskyNotPositive) {
+    Matrix<> matrix = {{4, 2, 1}, {2, 1, 3}, {1, 3, 5}};
+
+    auto factor = Cholesky(matrix);
+    EXPECT_FALSE(factor.IsPositiveDefinite());
+    EXPECT_EQ(factor.failed_pivot, 1);
+
+    Matrix<> negative = {{-1, 0}, {0, 1}};
+    EXPECT_EQ(CholeskyInPlace(negative), 0);
+}
+
+TEST(TEST_CHOLESKY, CholeskyView) {
+    RandomGenerator<double> gen(3);
+
+    auto inner = GetPositiveDefinite(gen, 20);
+    Matrix<double> matrix(22, 22);
+    auto view = matrix.GetSubmatrix({1, 21}, {1, 21});
+    view += inner;
+
+    ASSERT_EQ(CholeskyInPlace(view, 6), -1);
+
+    Matrix<double> L(20, 20);
+    for (IndexType i = 0; i < 20; ++i) {
+        for (IndexType j = 0; j <= i; ++j) {
+            L(i, j) = view(i, j);
+        }
+    }
+    CheckCholesky(inner, L);
+
+    // The upper triangle and the frame are left untouched.
+    EXPECT_EQ(view(0, 1), inner(0, 1));
+    EXPECT_EQ(matrix(0, 0), 0.);
+}
+
+TEST(TEST_CHOLESKY, Stress) {
+    using Type = Complex<long double>;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 10; ++seed) {
+        MatrixGenerator gen(seed);
+
+        auto matrix = GetPositiveDefinite(gen, gen.GetMatrixSize());
+        auto factor = Cholesky(matrix, 8);
+
+        ASSERT_TRUE(factor.IsPositiveDefinite());
+        CheckCholesky(matrix, factor.GetL());
+    }
+}
+} // namespace
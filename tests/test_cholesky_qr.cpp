@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/cholesky_qr.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+template <MatrixType M, typename P>
+void CheckThinQR(const M &matrix, const P &pair) {
+    using T = typename M::ElemType;
+    const auto &[Q, R] = pair;
+
+    EXPECT_TRUE(IsUpperTriangular(R));
+    EXPECT_TRUE(AreEqualMatrices(matrix, Q * R));
+
+    auto QHQ = Matrix<T>::Conjugated(Q) * Q;
+    EXPECT_TRUE(AreEqualMatrices(QHQ, Matrix<T>::Identity(Q.Columns())));
+}
+
+TEST(TEST_CHOLESKY_QR, CholeskyQRSimple) {
+    Matrix<> matrix = {{3, 1}, {4, 2}, {0, 5}};
+
+    auto pair = CholeskyQR2(matrix);
+    CheckThinQR(matrix, pair);
+    EXPECT_TRUE(AreEqualFloating(pair.R(0, 0), 5.l));
+}
+
+TEST(TEST_CHOLESKY_QR, CholeskyQRColumnBlock) {
+    RandomGenerator<double> gen(2);
+    auto matrix = gen.GetMatrix(60, 8) / 100.;
+    auto copy = matrix;
+
+    auto block = matrix.GetSubmatrix({0, 60}, {2, 6});
+    auto R = OrthonormalizeColumns(block);
+
+    auto original = copy.GetSubmatrix({0, 60}, {2, 6});
+    CheckThinQR(original, std::make_pair(Matrix<double>(block), R));
+
+    for (IndexType i = 0; i < 60; ++i) {
+        for (IndexType j : {0, 1, 6, 7}) {
+            EXPECT_EQ(matrix(i, j), copy(i, j));
+        }
+    }
+}
+
+TEST(TEST_CHOLESKY_QR, CholeskyQRIllConditioned) {
+    RandomGenerator<double> gen(3);
+
+    // Orthonormal columns scaled from 1 down to 1e-12, cond(A) = 1e12 is out
+    // of reach of the plain CholeskyQR2.
+    auto Q = CompactQR(gen.GetMatrix(200, 6)).GetQ();
+    Matrix<double> matrix(200, 6);
+    for (IndexType i = 0; i < 200; ++i) {
+        for (IndexType j = 0; j < 6; ++j) {
+            matrix(i, j) = Q(i, j) * std::pow(1e-12, j / 5.) +
+                           (j > 0 ? Q(i, 0) : 0.);
+        }
+    }
+
+    CheckThinQR(matrix, CholeskyQR2(matrix));
+}
+
+TEST(TEST_CHOLESKY_QR, CholeskyQRZeroColumn) {
+    Matrix<> matrix = {{1, 0, 2}, {2, 0, 1}, {3, 0, 1}, {4, 0, 5}};
+
+    CheckThinQR(matrix, CholeskyQR2(matrix));
+}
+
+TEST(TEST_CHOLESKY_QR, CholeskyQRComplex) {
+    RandomGenerator<Complex<>> gen(4);
+    auto matrix = gen.GetMatrix(50, 7) / Complex<>{100};
+
+    CheckThinQR(matrix, CholeskyQR2(matrix));
+}
+
+TEST(TEST_CHOLESKY_QR, Stress) {
+    using Type = Complex<double>;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 10; ++seed) {
+        MatrixGenerator gen(seed);
+
+        int32_t columns = gen.GetMatrixSize() / 4 + 1;
+        int32_t rows = columns + gen.GetMatrixSize() * 10;
+
+        auto matrix = gen.GetMatrix(rows, columns) / Type{100};
+        CheckThinQR(matrix, CholeskyQR2(matrix));
+    }
+}
+} // namespace
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/closed_form.h"
+#include "../src/algorithms/qr_algorithm.h"
+#include "../src/algorithms/svd.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+
+template <typename T, LinearKit::IndexType Rows, LinearKit::IndexType Cols>
+using FixedMatrix = LinearKit::Matrix<T, Rows, Cols>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+template <typename T>
+void CheckSymmetricEigen2x2(T a, T b, T c) {
+    auto [first, second, cos, sin] = GetSymmetricEigen2x2(a, b, c);
+    FixedMatrix<T, 2, 2> matrix = {{a, b}, {b, c}};
+    FixedMatrix<T, 2, 2> rotation = {{cos, -sin}, {sin, cos}};
+    FixedMatrix<T, 2, 2> D = {{first, 0}, {0, second}};
+
+    EXPECT_GE(std::abs(first), std::abs(second));
+    EXPECT_TRUE(IsUnitary(rotation, T{1e-12}));
+    EXPECT_TRUE(AreEqualMatrices(
+        matrix, rotation * D * FixedMatrix<T, 2, 2>::Transposed(rotation),
+        T{1e-12}));
+}
+
+template <typename T>
+void CheckTriangularSVD2x2(T f, T g, T h) {
+    auto svd = GetTriangularSVD2x2(f, g, h);
+    FixedMatrix<T, 2, 2> matrix = {{f, g}, {0, h}};
+    FixedMatrix<T, 2, 2> left = {{svd.csl, -svd.snl}, {svd.snl, svd.csl}};
+    FixedMatrix<T, 2, 2> right = {{svd.csr, svd.snr}, {-svd.snr, svd.csr}};
+    FixedMatrix<T, 2, 2> D = {{svd.max, 0}, {0, svd.min}};
+
+    EXPECT_GE(std::abs(svd.max), std::abs(svd.min));
+    EXPECT_TRUE(IsUnitary(left, T{1e-12}));
+    EXPECT_TRUE(IsUnitary(right, T{1e-12}));
+    EXPECT_TRUE(AreEqualMatrices(matrix, left * D * right, T{1e-12}));
+}
+
+TEST(TEST_CLOSED_FORM, SymmetricEigen2x2) {
+    CheckSymmetricEigen2x2(2.0, 1.0, 3.0);
+    CheckSymmetricEigen2x2(1.0, 0.0, 1.0);
+    CheckSymmetricEigen2x2(-1.0, 2.0, 1.0);
+    CheckSymmetricEigen2x2(0.0, 0.0, 0.0);
+    CheckSymmetricEigen2x2(1e8l, 1e-8l, -1e-8l);
+
+    RandomGenerator<double> gen(3);
+    for (int32_t it = 0; it < 100; ++it) {
+        CheckSymmetricEigen2x2(gen.GetRandomTypeNumber() / 100,
+                               gen.GetRandomTypeNumber() / 100,
+                               gen.GetRandomTypeNumber() / 100);
+    }
+}
+
+TEST(TEST_CLOSED_FORM, TriangularSVD2x2) {
+    CheckTriangularSVD2x2(3.0, 4.0, 5.0);
+    CheckTriangularSVD2x2(1.0, 0.0, 2.0);
+    CheckTriangularSVD2x2(0.0, 1.0, 0.0);
+    CheckTriangularSVD2x2(-2.0, 1e9, 3.0);
+    CheckTriangularSVD2x2(0.0, 0.0, 0.0);
+    CheckTriangularSVD2x2(1.0l, -1.0l, 1.0l);
+
+    RandomGenerator<double> gen(5);
+    for (int32_t it = 0; it < 100; ++it) {
+        CheckTriangularSVD2x2(gen.GetRandomTypeNumber() / 100,
+                              gen.GetRandomTypeNumber() / 100,
+                              gen.GetRandomTypeNumber() / 100);
+    }
+}
+
+TEST(TEST_CLOSED_FORM, SymmetricEigen3x3) {
+    using Type = long double;
+
+    std::vector<Matrix<Type>> matrices = {
+        {{4, 1, 2}, {1, 3, 0.5}, {2, 0.5, 1}},
+        {{2, 0, 0}, {0, 2, 0}, {0, 0, 2}},
+        {{1, 1, 1}, {1, 1, 1}, {1, 1, 1}},
+        {{2, 1, 0}, {1, 2, 0}, {0, 0, 3}},
+        {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}}};
+
+    RandomGenerator<Type> gen(7);
+    for (int32_t it = 0; it < 50; ++it) {
+        matrices.push_back(gen.GetSymmetricMatrix(3) / Type{100});
+    }
+
+    for (const auto &matrix : matrices) {
+        auto [D, U] = GetSymmetricEigen3x3(matrix);
+
+        EXPECT_TRUE(IsUnitary(U, Type{1e-12}));
+        EXPECT_TRUE(IsDiagonal(D));
+        EXPECT_GE(D(0, 0), D(1, 1));
+        EXPECT_GE(D(1, 1), D(2, 2));
+        EXPECT_TRUE(AreEqualMatrices(
+            matrix,
+            Matrix<Type>(U * D * FixedMatrix<Type, 3, 3>::Transposed(U)),
+            Type{1e-12}));
+    }
+}
+
+TEST(TEST_CLOSED_FORM, BidiagDeflation2x2) {
+    using Type = long double;
+
+    Matrix<Type> B = {{3, 4}, {0, 5}};
+    auto [U, D, VT] = BidiagAlgorithmQR(B);
+
+    EXPECT_TRUE(IsDiagonal(D));
+    EXPECT_TRUE(IsUnitary(U));
+    EXPECT_TRUE(IsUnitary(VT));
+    EXPECT_TRUE(AreEqualMatrices(B, U * D * VT));
+}
+
+TEST(TEST_CLOSED_FORM, BidiagWilkinsonShift) {
+    using Type = long double;
+
+    Matrix<Type> S = {{1, 2, 0}, {0, 3, 4}, {0, 0, 5}};
+    Matrix<Type> gram = Matrix<Type>::Transposed(S) * S;
+    auto shift = GetBidiagWilkinsonShift(S);
+
+    // The shift is an eigenvalue of the trailing 2 x 2 block of S^T * S.
+    auto a = gram(1, 1);
+    auto b = gram(1, 2);
+    auto c = gram(2, 2);
+    EXPECT_NEAR((a - shift) * (c - shift) - b * b, 0, 1e-9);
+}
+
+TEST(TEST_CLOSED_FORM, TridiagonalSpectral) {
+    using Type = long double;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 6; ++seed) {
+        MatrixGenerator gen(seed);
+        for (int32_t size : {1, 2, 3, 17, 60}) {
+            auto matrix = gen.GetSymmetricMatrix(size) / Type{100};
+            auto [D, U, is_converged] = GetCheckedSpecDecomposition(matrix);
+            EXPECT_TRUE(is_converged);
+
+            EXPECT_TRUE(IsDiagonal(D, Type{1e-12}));
+            EXPECT_TRUE(IsUnitary(U, Type{1e-10}));
+            EXPECT_TRUE(AreEqualMatrices(
+                matrix, U * D * Matrix<Type>::Transposed(U), Type{1e-10}));
+        }
+    }
+}
+} // namespace
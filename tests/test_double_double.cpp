@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include "../src/types/double_double.h"
+#include "../src/algorithms/lu.h"
+#include "../src/algorithms/svd.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+
+using LinearKit::DoubleDouble;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+static_assert(FloatOrComplex<DoubleDouble>);
+static_assert(std::is_same_v<RealType<DoubleDouble>, DoubleDouble>);
+static_assert(
+    !LinearKit::Utils::Details::IsFloatComplexT<DoubleDouble>::value);
+static_assert(std::numeric_limits<DoubleDouble>::digits == 106);
+
+double GetError(DoubleDouble lhs, DoubleDouble rhs) {
+    return std::abs((lhs - rhs).High());
+}
+
+double GetMaxError(const Matrix<DoubleDouble> &lhs,
+                   const Matrix<DoubleDouble> &rhs) {
+    double error = 0;
+    for (IndexType i = 0; i < lhs.Rows(); ++i) {
+        for (IndexType j = 0; j < lhs.Columns(); ++j) {
+            error = std::max(error, GetError(lhs(i, j), rhs(i, j)));
+        }
+    }
+    return error;
+}
+
+TEST(TEST_DOUBLE_DOUBLE, Arithmetic) {
+    DoubleDouble one = 1;
+    DoubleDouble three = 3;
+
+    auto third = one / three;
+    EXPECT_NE(third.Low(), 0);
+    EXPECT_LT(GetError(third * three, one), 1e-31);
+
+    // 1 + 2^-70 is lost in double, but not in the double-double.
+    DoubleDouble tiny = std::ldexp(1.0, -70);
+    EXPECT_EQ((one + tiny - one).High(), std::ldexp(1.0, -70));
+    EXPECT_GT(one + tiny, one);
+    EXPECT_LT(-(one + tiny), -one);
+
+    auto root = Sqrt(DoubleDouble(2));
+    EXPECT_LT(GetError(root * root, DoubleDouble(2)), 1e-31);
+    EXPECT_EQ(Sqrt(DoubleDouble(0)), DoubleDouble(0));
+
+    EXPECT_EQ(Abs(DoubleDouble(-2.5)), DoubleDouble(2.5));
+    EXPECT_EQ(Sign(DoubleDouble(-1e-40)), DoubleDouble(-1));
+    EXPECT_EQ(Sign(DoubleDouble(0)), DoubleDouble(1));
+
+    DoubleDouble from_long = 1.1l;
+    EXPECT_EQ(static_cast<long double>(from_long), 1.1l);
+}
+
+TEST(TEST_DOUBLE_DOUBLE, Eps) {
+    EXPECT_TRUE(AreEqualFloating(DoubleDouble(1),
+                                 DoubleDouble(1) + DoubleDouble(1e-30)));
+    EXPECT_FALSE(AreEqualFloating(DoubleDouble(1),
+                                  DoubleDouble(1) + DoubleDouble(1e-20)));
+    EXPECT_LT(std::numeric_limits<DoubleDouble>::epsilon(),
+              DoubleDouble(1e-31));
+}
+
+TEST(TEST_DOUBLE_DOUBLE, Matrix) {
+    Matrix<DoubleDouble> matrix = {{1, 2}, {3, 4}};
+    auto product = matrix * Matrix<DoubleDouble>::Identity(2);
+    EXPECT_TRUE(product == matrix);
+
+    auto [U, D, VT] = BidiagAlgorithmQR(Matrix<DoubleDouble>{{3, 4}, {0, 5}});
+    auto restored = U * D * VT;
+    EXPECT_LT(GetError(restored(0, 1), DoubleDouble(4)), 1e-30);
+    EXPECT_LT(GetError(restored(1, 0), DoubleDouble(0)), 1e-30);
+}
+
+TEST(TEST_DOUBLE_DOUBLE, GradedBidiagonal) {
+    // The product of the singular values equals |det B| = 2^-60. The smallest
+    // one is about 1e-19 of the norm, the double-double keeps the determinant
+    // to 1e-30.
+    auto check = [] {
+        using T = DoubleDouble;
+
+        Matrix<T> B(4, 4);
+        for (IndexType i = 0; i < 4; ++i) {
+            B(i, i) = (i == 1 || i == 2) ? std::ldexp(1.0, -30) : 1.0;
+            if (i < 3) {
+                B(i, i + 1) = 1;
+            }
+        }
+
+        auto [U, D, VT] = BidiagAlgorithmQR(B);
+        T det = 1;
+        for (IndexType i = 0; i < 4; ++i) {
+            det *= Abs(D(i, i));
+        }
+        return static_cast<long double>(det / T(std::ldexp(1.0, -60)));
+    };
+
+    EXPECT_NEAR(check(), 1.0l, 1e-30);
+}
+
+TEST(TEST_DOUBLE_DOUBLE, SVD) {
+    RandomGenerator<double> gen(17);
+
+    for (auto [rows, cols] :
+         {std::pair{1, 1}, {5, 5}, {12, 7}, {7, 12}, {40, 40}}) {
+        auto matrix = gen.GetMatrix(rows, cols) / 100.0;
+        auto [U, S, VT] = SVD<DoubleDouble>(matrix);
+        auto [U_ld, S_ld, VT_ld] = SVD(matrix, SVDEngine::BidiagQR);
+
+        EXPECT_TRUE(IsUnitary(U));
+        EXPECT_TRUE(IsUnitary(VT));
+
+        Matrix<double> sigma(rows, cols);
+        for (IndexType i = 0; i < S.Columns(); ++i) {
+            sigma(i, i) = S(0, i);
+            EXPECT_NEAR(S(0, i), S_ld(0, i), 1e-12);
+        }
+        EXPECT_TRUE(AreEqualMatrices(matrix, U * sigma * VT));
+    }
+}
+
+TEST(TEST_DOUBLE_DOUBLE, ElementSVD) {
+    RandomGenerator<double> gen(23);
+
+    for (auto [rows, cols] : {std::pair{6, 6}, {40, 33}, {12, 35}}) {
+        auto matrix =
+            CastMatrix<DoubleDouble>(gen.GetMatrix(rows, cols) / 100.0);
+
+        auto check = [&](const auto &U, const auto &S, const auto &VT,
+                         double eps) {
+            EXPECT_LT(GetMaxError(Matrix<DoubleDouble>::Conjugated(U) * U,
+                                  Matrix<DoubleDouble>::Identity(rows)),
+                      eps);
+            EXPECT_LT(GetMaxError(VT * Matrix<DoubleDouble>::Conjugated(VT),
+                                  Matrix<DoubleDouble>::Identity(cols)),
+                      eps);
+            EXPECT_LT(
+                GetMaxError(matrix, U * Matrix<DoubleDouble>::Diagonal(
+                                            S, rows, cols) * VT),
+                eps);
+        };
+
+        // To a few Eps<DoubleDouble>, the bidiagonal QR stops there.
+        auto [U, S, VT] = SVD<DoubleDouble>(matrix);
+        check(U, S, VT, 1e-23);
+
+        auto jacobi = JacobiSVD(matrix);
+        EXPECT_TRUE(jacobi.is_converged);
+        check(jacobi.U, jacobi.S, jacobi.VT, 1e-23);
+
+        // The bidiagonal stage in long double.
+        auto wide = SVD(matrix);
+        check(wide.U, wide.S, wide.VT, 1e-15);
+    }
+}
+
+TEST(TEST_DOUBLE_DOUBLE, ElementLU) {
+    RandomGenerator<double> gen(29);
+
+    auto matrix = CastMatrix<DoubleDouble>(gen.GetMatrix(20, 20));
+    auto factor = LU(matrix);
+    EXPECT_FALSE(factor.IsSingular());
+    EXPECT_LT(GetMaxError(factor.GetP() * matrix,
+                          factor.GetL() * factor.GetU()),
+              1e-26);
+}
+} // namespace
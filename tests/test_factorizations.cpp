@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/factorizations.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+#include <thread>
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+TEST(TEST_FACTORIZATIONS, QRSolve) {
+    Matrix<> matrix = {{2, 1, 1}, {4, -6, 0}, {-2, 7, 2}};
+    Matrix<> rhs = {{5, 1}, {-2, 0}, {9, 0}};
+
+    QRFactorization factor(matrix);
+    auto X = factor.Solve(rhs);
+
+    EXPECT_TRUE(AreEqualMatrices(matrix * X, rhs));
+    EXPECT_TRUE(AreEqualFloating(X(2, 0), 2.l));
+    EXPECT_EQ(factor.Rank(), 3);
+    EXPECT_GE(factor.ConditionNumber(), 1.l);
+}
+
+TEST(TEST_FACTORIZATIONS, QRLeastSquares) {
+    Matrix<> matrix = {{1, 0}, {1, 1}, {1, 2}};
+    Matrix<> rhs = {{6}, {0}, {0}};
+
+    auto X = QRFactorization(matrix).Solve(rhs);
+    EXPECT_TRUE(AreEqualFloating(X(0, 0), 5.l));
+    EXPECT_TRUE(AreEqualFloating(X(1, 0), -3.l));
+}
+
+TEST(TEST_FACTORIZATIONS, SVDPseudoinverse) {
+    Matrix<> matrix = {{1, 2}, {2, 4}, {0, 0}};
+    Matrix<> rhs = {{1}, {2}, {3}};
+
+    SVDFactorization factor(matrix);
+    EXPECT_EQ(factor.Rank(), 1);
+    EXPECT_EQ(factor.ConditionNumber(),
+              std::numeric_limits<long double>::infinity());
+
+    // The pseudoinverse of the rank one matrix u * v^T is
+    // v * u^T / (|u|^2 |v|^2) with u = (1, 2, 0) and v = (1, 2).
+    auto X = factor.ApplyPseudoinverse(rhs);
+    EXPECT_TRUE(AreEqualFloating(X(0, 0), 0.2l));
+    EXPECT_TRUE(AreEqualFloating(X(1, 0), 0.4l));
+}
+
+TEST(TEST_FACTORIZATIONS, SVDConditionNumber) {
+    Matrix<> matrix = {{3, 0}, {0, -0.5}};
+
+    SVDFactorization factor(matrix, SVDEngine::Jacobi);
+    EXPECT_TRUE(AreEqualFloating(factor.ConditionNumber(), 6.l));
+    EXPECT_EQ(factor.Rank(0.5), 1);
+    EXPECT_EQ(factor.Rank(), 2);
+}
+
+TEST(TEST_FACTORIZATIONS, SVDComplex) {
+    RandomGenerator<Complex<>> gen(3);
+
+    auto matrix = gen.GetWellConditioned(12, 8);
+    auto rhs = gen.GetMatrix(12, 2) / Complex<>{100};
+
+    SVDFactorization svd(matrix);
+    QRFactorization qr(matrix);
+    EXPECT_EQ(svd.Rank(), 8);
+    EXPECT_TRUE(AreEqualMatrices(svd.Solve(rhs), qr.Solve(rhs)));
+}
+
+TEST(TEST_FACTORIZATIONS, EigenSolve) {
+    Matrix<> matrix = {{2, 1, 0}, {1, 2, 0}, {0, 0, -4}};
+    Matrix<> rhs = {{1}, {2}, {3}};
+
+    EigenFactorization factor(matrix);
+    auto X = factor.Solve(rhs);
+
+    EXPECT_TRUE(AreEqualMatrices(matrix * X, rhs));
+    EXPECT_EQ(factor.Rank(), 3);
+    EXPECT_TRUE(AreEqualFloating(factor.ConditionNumber(), 4.l));
+}
+
+TEST(TEST_FACTORIZATIONS, EigenSingular) {
+    Matrix<> matrix = {{1, 1}, {1, 1}};
+    Matrix<> rhs = {{2}, {0}};
+
+    EigenFactorization factor(matrix);
+    EXPECT_EQ(factor.Rank(), 1);
+
+    auto X = factor.ApplyPseudoinverse(rhs);
+    EXPECT_TRUE(AreEqualFloating(X(0, 0), 0.5l));
+    EXPECT_TRUE(AreEqualFloating(X(1, 0), 0.5l));
+}
+
+TEST(TEST_FACTORIZATIONS, ConcurrentSolve) {
+    RandomGenerator<double> gen(5);
+
+    auto matrix = gen.GetWellConditioned(40, 40);
+    const QRFactorization qr(matrix);
+    const SVDFactorization svd(matrix);
+
+    constexpr int kThreads = 4;
+    std::vector<Matrix<double>> rhs;
+    std::vector<Matrix<double>> qr_results(kThreads);
+    std::vector<Matrix<double>> svd_results(kThreads);
+    for (int i = 0; i < kThreads; ++i) {
+        rhs.push_back(gen.GetMatrix(40, 3) / 100.);
+    }
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&, i] {
+            qr_results[i] = qr.Solve(rhs[i]);
+            svd_results[i] = svd.Solve(rhs[i]);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < kThreads; ++i) {
+        EXPECT_TRUE(AreEqualMatrices(matrix * qr_results[i], rhs[i]));
+        EXPECT_TRUE(AreEqualMatrices(qr_results[i], svd_results[i]));
+    }
+}
+
+TEST(TEST_FACTORIZATIONS, Stress) {
+    using Type = double;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 6; ++seed) {
+        MatrixGenerator gen(seed);
+
+        int32_t size = gen.GetMatrixSize() / 2 + 1;
+        auto matrix = gen.GetSymmetricMatrix(size) / 100.;
+        for (IndexType i = 0; i < size; ++i) {
+            matrix(i, i) += 3. * (i + 1);
+        }
+        auto rhs = gen.GetMatrix(size, 2) / 100.;
+
+        auto X = EigenFactorization(matrix).Solve(rhs);
+        EXPECT_TRUE(AreEqualMatrices(matrix * X, rhs));
+        EXPECT_TRUE(AreEqualMatrices(SVDFactorization(matrix).Solve(rhs), X));
+    }
+}
+} // namespace
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/factorizations.h"
+#include "../src/algorithms/qr_algorithm.h"
+#include "../src/algorithms/svd.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+
+template <typename T, LinearKit::IndexType Rows, LinearKit::IndexType Cols>
+using FixedMatrix = LinearKit::Matrix<T, Rows, Cols>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+static_assert(MatrixType<FixedMatrix<double, 3, 3>>);
+static_assert(MutableMatrixType<FixedMatrix<double, 3, 3>>);
+static_assert(FixedMatrixType<FixedMatrix<double, 2, 5>>);
+static_assert(!FixedMatrixType<Matrix<double>>);
+static_assert(sizeof(FixedMatrix<double, 3, 3>) == 9 * sizeof(double));
+
+template <typename T, IndexType Rows, IndexType Cols>
+FixedMatrix<T, Rows, Cols> GetFixed(RandomGenerator<T> &gen) {
+    return FixedMatrix<T, Rows, Cols>(gen.GetMatrix(Rows, Cols) / T{100});
+}
+
+template <typename T, IndexType Rows, IndexType Cols>
+void CheckFixedQR(const FixedMatrix<T, Rows, Cols> &matrix) {
+    auto [Q, R] = HouseholderQR(matrix);
+    static_assert(std::is_same_v<decltype(Q), FixedMatrix<T, Rows, Rows>>);
+
+    EXPECT_TRUE(IsUnitary(Q));
+    EXPECT_TRUE(IsUpperTriangular(R));
+    EXPECT_TRUE(AreEqualMatrices(matrix, Q * R));
+}
+
+template <typename T, IndexType Rows, IndexType Cols>
+void CheckFixedSVD(const FixedMatrix<T, Rows, Cols> &matrix) {
+    auto [U, S, VT] = SVD(matrix);
+    static_assert(std::is_same_v<decltype(VT), FixedMatrix<T, Cols, Cols>>);
+
+    EXPECT_TRUE(IsUnitary(U));
+    EXPECT_TRUE(IsUnitary(VT));
+
+    FixedMatrix<T, Rows, Cols> sigma;
+    for (IndexType i = 0; i < S.Columns(); ++i) {
+        sigma(i, i) = S(0, i);
+        if (i > 0) {
+            EXPECT_GE(std::real(S(0, i - 1)), std::real(S(0, i)));
+        }
+    }
+    EXPECT_TRUE(AreEqualMatrices(matrix, U * sigma * VT));
+
+    auto [U_dyn, S_dyn, VT_dyn] = SVD(Matrix<T>(matrix));
+    EXPECT_TRUE(AreEqualMatrices(S, S_dyn));
+}
+
+TEST(TEST_FIXED_MATRIX, FixedConstexpr) {
+    using Fixed = FixedMatrix<double, 2, 2>;
+
+    constexpr Fixed matrix = {{1, 2}, {3, 4}};
+    constexpr auto result =
+        matrix * Fixed::Identity() * 2. + Fixed::Transposed(matrix) - matrix;
+    static_assert(result(0, 1) == 5 && result(1, 0) == 5);
+    static_assert(result(0, 0) == 2 && result(1, 1) == 8);
+
+    constexpr FixedMatrix<double, 2, 3> wide = {{1, 0, 1}, {0, 1, 1}};
+    constexpr auto product = matrix * wide;
+    static_assert(product.Rows() == 2 && product.Columns() == 3);
+    static_assert(product(1, 2) == 7);
+}
+
+TEST(TEST_FIXED_MATRIX, FixedConversions) {
+    FixedMatrix<Complex<>, 2, 3> fixed = {{{1, 1}, {2, 0}, {0, 3}},
+                                          {{4, 0}, {0, -1}, {5, 5}}};
+
+    Matrix<Complex<>> dynamic = fixed;
+    EXPECT_EQ(dynamic.Rows(), 2);
+    EXPECT_EQ(dynamic.Columns(), 3);
+    EXPECT_TRUE(dynamic == fixed);
+
+    FixedMatrix<Complex<>, 2, 3> back(dynamic);
+    EXPECT_TRUE(back == fixed);
+
+    auto adjoint = FixedMatrix<Complex<>, 2, 3>::Conjugated(fixed);
+    EXPECT_TRUE(adjoint == Matrix<Complex<>>::Conjugated(dynamic));
+
+    // Mixed arithmetic goes through the dynamic operators.
+    Matrix<Complex<>> sum = fixed + dynamic;
+    EXPECT_TRUE(sum == dynamic * Complex<>{2});
+}
+
+TEST(TEST_FIXED_MATRIX, FixedGenericAlgorithms) {
+    FixedMatrix<double, 3, 3> matrix = {{4, 1, 0}, {1, 3, 1}, {0, 1, 2}};
+    FixedMatrix<double, 3, 1> rhs = {{1}, {2}, {3}};
+
+    auto factor = CompactQR(matrix);
+    EXPECT_EQ(factor.QR.Rows(), 3);
+
+    QRFactorization qr(matrix);
+    auto solution = qr.Solve(rhs);
+    EXPECT_TRUE(AreEqualMatrices(matrix * FixedMatrix<double, 3, 1>(solution),
+                                 rhs));
+}
+
+TEST(TEST_FIXED_MATRIX, FixedQR) {
+    CheckFixedQR(FixedMatrix<long double, 3, 2>{{1, 2}, {3, 4}, {5, 6}});
+    CheckFixedQR(FixedMatrix<long double, 2, 2>{{0, 1}, {0, 0}});
+
+    RandomGenerator<double> gen(2);
+    CheckFixedQR(GetFixed<double, 4, 4>(gen));
+    CheckFixedQR(GetFixed<double, 8, 5>(gen));
+    CheckFixedQR(GetFixed<double, 3, 6>(gen));
+
+    RandomGenerator<Complex<double>> complex_gen(3);
+    CheckFixedQR(GetFixed<Complex<double>, 5, 3>(complex_gen));
+}
+
+TEST(TEST_FIXED_MATRIX, FixedSpectral) {
+    FixedMatrix<long double, 3, 3> matrix = {{1, 2, 3}, {2, 4, 5}, {3, 5, 6}};
+
+    auto [D, U] = GetSpecDecomposition(matrix);
+    static_assert(std::is_same_v<decltype(D), decltype(matrix)>);
+    EXPECT_TRUE(IsUnitary(U));
+    EXPECT_TRUE(IsDiagonal(D));
+    EXPECT_TRUE(AreEqualMatrices(matrix, U * D * decltype(U)::Conjugated(U)));
+
+    FixedMatrix<Complex<>, 2, 2> hermitian = {{{2, 0}, {1, 1}},
+                                              {{1, -1}, {3, 0}}};
+    auto [D_c, U_c] = GetSpecDecomposition(hermitian);
+    EXPECT_TRUE(IsUnitary(U_c));
+    EXPECT_TRUE(AreEqualMatrices(
+        hermitian, U_c * D_c * decltype(U_c)::Conjugated(U_c)));
+}
+
+TEST(TEST_FIXED_MATRIX, FixedSVD) {
+    CheckFixedSVD(
+        FixedMatrix<long double, 3, 3>{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+    CheckFixedSVD(FixedMatrix<long double, 2, 2>{{0, 0}, {0, 0}});
+
+    RandomGenerator<double> gen(4);
+    CheckFixedSVD(GetFixed<double, 3, 3>(gen));
+    CheckFixedSVD(GetFixed<double, 6, 4>(gen));
+    CheckFixedSVD(GetFixed<double, 2, 7>(gen));
+
+    RandomGenerator<Complex<double>> complex_gen(5);
+    CheckFixedSVD(GetFixed<Complex<double>, 4, 3>(complex_gen));
+}
+
+TEST(TEST_FIXED_MATRIX, Stress) {
+    for (int32_t seed = 1; seed < 30; ++seed) {
+        RandomGenerator<double> gen(seed);
+
+        CheckFixedQR(GetFixed<double, 3, 3>(gen));
+        CheckFixedQR(GetFixed<double, 7, 4>(gen));
+        CheckFixedSVD(GetFixed<double, 4, 4>(gen));
+        CheckFixedSVD(GetFixed<double, 8, 3>(gen));
+
+        auto matrix = GetFixed<double, 6, 6>(gen);
+        auto symmetric = matrix + FixedMatrix<double, 6, 6>::Transposed(matrix);
+        auto [D, U] = GetSpecDecomposition(symmetric);
+        EXPECT_TRUE(IsUnitary(U));
+        EXPECT_TRUE(AreEqualMatrices(
+            symmetric, U * D * FixedMatrix<double, 6, 6>::Transposed(U)));
+    }
+}
+} // namespace
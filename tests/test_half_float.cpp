@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include "../src/types/half_float.h"
+#include "../src/algorithms/cholesky.h"
+#include "../src/algorithms/factorizations.h"
+#include "../src/algorithms/lu.h"
+#include "../src/algorithms/qr_decomposition.h"
+#include "../src/algorithms/svd.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+
+using LinearKit::BFloat16;
+using LinearKit::Float16;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+static_assert(sizeof(Float16) == 2 && sizeof(BFloat16) == 2);
+static_assert(FloatOrComplex<Float16> && FloatOrComplex<BFloat16>);
+static_assert(StorageFloat<Float16> && !StorageFloat<double>);
+static_assert(std::is_same_v<WideType<BFloat16>, float>);
+static_assert(std::is_same_v<WideType<std::complex<double>>,
+                             std::complex<double>>);
+
+TEST(TEST_HALF_FLOAT, Rounding) {
+    EXPECT_EQ(Float16(1.0).Bits(), 0x3C00);
+    EXPECT_EQ(BFloat16(1.0).Bits(), 0x3F80);
+    EXPECT_EQ(static_cast<float>(Float16(65504)), 65504.0f);
+    EXPECT_EQ(static_cast<float>(std::numeric_limits<Float16>::epsilon()),
+              std::ldexp(1.0f, -10));
+    EXPECT_EQ(static_cast<float>(std::numeric_limits<BFloat16>::epsilon()),
+              std::ldexp(1.0f, -7));
+
+    // 1 + 2^-8 is halfway between the neighbours of 1 in bfloat16 and goes
+    // to the even one; 1 + 3 * 2^-9 goes up.
+    EXPECT_EQ(BFloat16(1.0f + std::ldexp(1.0f, -8)), BFloat16(1));
+    EXPECT_EQ(static_cast<float>(BFloat16(1.0f + 3 * std::ldexp(1.0f, -9))),
+              1.0f + std::ldexp(1.0f, -7));
+    EXPECT_NE(BFloat16(std::numeric_limits<float>::quiet_NaN()),
+              BFloat16(std::numeric_limits<float>::quiet_NaN()));
+
+    EXPECT_EQ(Abs(Float16(-2.5)), Float16(2.5));
+    EXPECT_EQ(Sqrt(BFloat16(4)), BFloat16(2));
+    EXPECT_EQ(Sign(Float16(-0.5)), Float16(-1));
+    EXPECT_LT(-Float16(1), Float16(0));
+}
+
+TEST(TEST_HALF_FLOAT, SoftwareBinary16) {
+    using Format = LinearKit::Details::Binary16Format;
+
+    EXPECT_EQ(Format::SoftwareFromFloat(1.0f), 0x3C00);
+    EXPECT_EQ(Format::SoftwareFromFloat(-65504.0f), 0xFBFF);
+    EXPECT_EQ(Format::SoftwareFromFloat(65520.0f), 0x7C00);
+    EXPECT_EQ(Format::SoftwareFromFloat(std::ldexp(1.0f, -24)), 0x0001);
+    EXPECT_EQ(Format::SoftwareFromFloat(std::ldexp(1.0f, -25)), 0x0000);
+    EXPECT_EQ(Format::SoftwareFromFloat(3 * std::ldexp(1.0f, -25)), 0x0002);
+    EXPECT_EQ(Format::SoftwareToFloat(0x0001), std::ldexp(1.0f, -24));
+    EXPECT_EQ(Format::SoftwareToFloat(0xFC00),
+              -std::numeric_limits<float>::infinity());
+    EXPECT_TRUE(std::isnan(Format::SoftwareToFloat(0x7E00)));
+    EXPECT_TRUE(std::isnan(
+        Format::SoftwareToFloat(Format::SoftwareFromFloat(NAN))));
+
+    // Every binary16 value goes to float and back unchanged.
+    for (std::uint32_t bits = 0; bits <= 0xFFFF; ++bits) {
+        auto half = static_cast<std::uint16_t>(bits);
+        auto value = Format::SoftwareToFloat(half);
+        if (!std::isnan(value)) {
+            ASSERT_EQ(Format::SoftwareFromFloat(value), half);
+            ASSERT_EQ(value, Format::ToFloat(half));
+        }
+    }
+
+    // Random float bit patterns, about a sixth of them in the binary16 range.
+    std::mt19937 rng(19);
+    for (IndexType i = 0; i < 100000; ++i) {
+        auto value = std::bit_cast<float>(static_cast<std::uint32_t>(rng()));
+        if (!std::isnan(value)) {
+            ASSERT_EQ(Format::SoftwareFromFloat(value),
+                      Format::FromFloat(value));
+        }
+    }
+}
+
+TEST(TEST_HALF_FLOAT, WideAccumulation) {
+    // 4096 + 1 is not representable in Float16, so a narrow sum of ones
+    // stalls at 2048; the product accumulates in float.
+    IndexType size = 4096;
+    Matrix<Float16> row(1, size);
+    Matrix<Float16> column(size, 1);
+    row.ApplyForEach([](Float16 &val) { val = 1; });
+    column.ApplyForEach([](Float16 &val) { val = 1; });
+
+    EXPECT_EQ(static_cast<float>((row * column)(0, 0)), 4096.0f);
+    EXPECT_EQ(static_cast<float>(row.GetEuclideanNorm()), 64.0f);
+
+    RandomGenerator<double> gen(21);
+    auto A = gen.GetMatrix(30, 20) / 100.0;
+    auto x = gen.GetMatrix(20, 1) / 100.0;
+    auto product = CastMatrix<double>(CastMatrix<BFloat16>(A) *
+                                      CastMatrix<BFloat16>(x));
+    EXPECT_TRUE(AreEqualMatrices(product, A * x, 5e-2));
+}
+
+TEST(TEST_HALF_FLOAT, Decompositions) {
+    RandomGenerator<double> gen(23);
+    auto source = gen.GetMatrix(24, 16) / 100.0;
+    auto matrix = CastMatrix<Float16>(source);
+    auto wide = WidenMatrix(matrix);
+
+    auto [Q, R] = HouseholderQR(matrix);
+    static_assert(std::is_same_v<decltype(Q), Matrix<float>>);
+    EXPECT_TRUE(AreEqualMatrices(Q * R, wide, 1e-4f));
+
+    auto qr = CompactQR(matrix);
+    EXPECT_TRUE(AreEqualMatrices(qr.GetR(), CompactQR(wide).GetR()));
+
+    auto square = CastMatrix<Float16>(source.GetSubmatrix({0, 16}, {0, 16}));
+    auto lu = LU(square);
+    EXPECT_TRUE(AreEqualMatrices(lu.GetL() * lu.GetU(),
+                                 lu.GetP() * WidenMatrix(square), 1e-4f));
+
+    auto gram = Matrix<Float16>::Identity(16) +
+                CastMatrix<Float16>(Matrix<double>::Transposed(source) *
+                                    source);
+    auto cholesky = Cholesky(gram);
+    ASSERT_TRUE(cholesky.IsPositiveDefinite());
+    EXPECT_TRUE(AreEqualMatrices(
+        cholesky.GetL() * Matrix<float>::Transposed(cholesky.GetL()),
+        WidenMatrix(gram), 1e-4f));
+
+    auto [U, S, VT] = SVD(matrix);
+    EXPECT_TRUE(IsUnitary(U));
+    EXPECT_TRUE(IsUnitary(VT));
+
+    Matrix<float> sigma(24, 16);
+    for (IndexType i = 0; i < S.Columns(); ++i) {
+        sigma(i, i) = S(0, i);
+    }
+    EXPECT_TRUE(AreEqualMatrices(U * sigma * VT, wide, 1e-4f));
+}
+
+TEST(TEST_HALF_FLOAT, Factorizations) {
+    RandomGenerator<double> gen(25);
+    auto source = gen.GetMatrix(20, 12) / 100.0;
+    auto matrix = CastMatrix<Float16>(source);
+    auto wide = WidenMatrix(matrix);
+    auto rhs = CastMatrix<float>(gen.GetMatrix(20, 1) / 100.0);
+
+    QRFactorization qr(matrix);
+    static_assert(std::is_same_v<decltype(qr), QRFactorization<float>>);
+    EXPECT_EQ(qr.Rank(), 12);
+
+    QRFactorization moved(CastMatrix<Float16>(source));
+    static_assert(std::is_same_v<decltype(moved), QRFactorization<float>>);
+
+    SVDFactorization svd(matrix);
+    static_assert(std::is_same_v<decltype(svd), SVDFactorization<float>>);
+    EXPECT_EQ(svd.Rank(), 12);
+
+    // Both give the least squares solution of the widened matrix.
+    auto x = qr.Solve(rhs);
+    EXPECT_TRUE(AreEqualMatrices(x, svd.Solve(rhs), 1e-3f));
+    EXPECT_TRUE(AreEqualMatrices(x, moved.Solve(rhs), 1e-3f));
+
+    auto residual = Matrix<float>::Transposed(wide) * (wide * x - rhs);
+    EXPECT_TRUE(AreEqualMatrices(residual, Matrix<float>(12, 1), 1e-4f));
+}
+} // namespace
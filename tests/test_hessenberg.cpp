@@ -15,6 +15,7 @@ using namespace LinearKit::Algorithm;
 using namespace LinearKit::Utils;
 using namespace LinearKit::MatrixUtils;
 using LinearKit::Tests::RandomGenerator;
+using IndexType = LinearKit::Details::Types::IndexType;
 
 template <MatrixType M, MatrixType F, MatrixType S>
 void CheckHessenberg(const M &matrix, const F &U, const S &H) {
@@ -66,6 +67,50 @@ TEST(TEST_HESSENBERG, HessenbergView) {
     CheckHessenberg(view, U, H);
 }
 
+TEST(TEST_HESSENBERG, BlockedSquare) {
+    using Matrix = Matrix<long double>;
+
+    Matrix matrix = {{1, 2, 3, 4, 1},
+                     {5, 6, 7, 8, 2},
+                     {9, 10, 11, 12, 3},
+                     {13, 14, 15, 16, 4},
+                     {-1, 2, 0, 5, 7}};
+
+    for (IndexType block = 1; block <= 4; ++block) {
+        auto [H, U] = GetBlockedHessenbergForm(matrix, block);
+        CheckHessenberg(matrix, U, H);
+    }
+}
+
+TEST(TEST_HESSENBERG, BlockedComplex) {
+    using Matrix = Matrix<Complex<long double>>;
+
+    Matrix matrix = {{{1, 2}, {3, 4}, {-1, 2}},
+                     {{7, -3}, {-3, 2}, {-5, -3}},
+                     {{-6, 3}, {0, -1}, {8, 9}}};
+
+    auto [H, U] = GetBlockedHessenbergForm(matrix, 1);
+    CheckHessenberg(matrix, U, H);
+
+    auto reduction = ReduceToHessenberg(Matrix{{{1, 2}}});
+    EXPECT_TRUE(AreEqualMatrices(reduction.GetQ(), Matrix::Identity(1)));
+}
+
+TEST(TEST_HESSENBERG, BlockedStress) {
+    using Type = Complex<long double>;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 5; ++seed) {
+        MatrixGenerator gen(seed);
+
+        int32_t size = gen.GetMatrixSize();
+        auto matrix = gen.GetMatrix(size, size);
+
+        auto [H, U] = GetBlockedHessenbergForm(matrix, 8);
+        CheckHessenberg(matrix, U, H);
+    }
+}
+
 TEST(TEST_HESSENBERG, Stress) {
     using Type = Complex<long double>;
     using MatrixGenerator = RandomGenerator<Type>;
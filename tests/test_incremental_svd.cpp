@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/incremental_svd.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+template <typename F>
+void CheckOrthonormal(const F &factor) {
+    using T = typename std::remove_cvref_t<decltype(factor.GetU())>::ElemType;
+
+    for (const auto *basis : {&factor.GetU(), &factor.GetV()}) {
+        auto product = Matrix<T>::Conjugated(*basis) * *basis;
+        EXPECT_TRUE(
+            AreEqualMatrices(product, Matrix<T>::Identity(factor.Rank())));
+    }
+}
+
+TEST(TEST_INCREMENTAL_SVD, IncrementalDiagonal) {
+    Matrix<> matrix = {{3, 0}, {0, 4}, {0, 0}};
+
+    IncrementalSVD<long double> factor(3, 2);
+    factor.AppendColumns(matrix.GetSubmatrix({0, 3}, {0, 1}));
+    EXPECT_EQ(factor.Rank(), 1);
+
+    factor.AppendColumns(matrix.GetSubmatrix({0, 3}, {1, 2}));
+    EXPECT_EQ(factor.Rank(), 2);
+    EXPECT_TRUE(AreEqualFloating(factor.GetSingularValues()[0], 4.l));
+    EXPECT_TRUE(AreEqualFloating(factor.GetSingularValues()[1], 3.l));
+    EXPECT_TRUE(AreEqualMatrices(factor.Reconstruct(), matrix));
+}
+
+TEST(TEST_INCREMENTAL_SVD, IncrementalLowRank) {
+    RandomGenerator<double> gen(2);
+    auto matrix = gen.GetLowRank(40, 60, 5);
+
+    IncrementalSVD factor(matrix.GetSubmatrix({0, 40}, {0, 10}), 8, 1e-9);
+    for (IndexType from = 10; from < 60; from += 10) {
+        factor.AppendColumns(matrix.GetSubmatrix({0, 40}, {from, from + 10}));
+    }
+
+    EXPECT_EQ(factor.Columns(), 60);
+    EXPECT_EQ(factor.Rank(), 5);
+    CheckOrthonormal(factor);
+    EXPECT_TRUE(AreEqualMatrices(factor.Reconstruct(), matrix));
+
+    auto [U, S, VT] = SVD(matrix);
+    for (IndexType i = 0; i < 5; ++i) {
+        EXPECT_TRUE(AreEqualFloating(factor.GetSingularValues()[i], S(0, i)));
+    }
+}
+
+TEST(TEST_INCREMENTAL_SVD, IncrementalTruncated) {
+    RandomGenerator<double> gen(3);
+    auto matrix = gen.GetMatrix(30, 24) / 100.;
+
+    IncrementalSVD<double> factor(30, 6);
+    for (IndexType from = 0; from < 24; from += 3) {
+        factor.AppendColumns(matrix.GetSubmatrix({0, 30}, {from, from + 3}));
+    }
+
+    EXPECT_EQ(factor.Rank(), 6);
+    CheckOrthonormal(factor);
+
+    const auto &sigma = factor.GetSingularValues();
+    EXPECT_TRUE(std::is_sorted(sigma.rbegin(), sigma.rend()));
+
+    // The leading singular value of a truncated stream is a lower bound.
+    auto [U, S, VT] = SVD(matrix);
+    EXPECT_LE(sigma[0], S(0, 0) + 1e-9);
+    EXPECT_GE(sigma[0], S(0, 0) * 0.9);
+}
+
+TEST(TEST_INCREMENTAL_SVD, IncrementalComplex) {
+    RandomGenerator<Complex<>> gen(4);
+    auto matrix = gen.GetLowRank(12, 20, 3);
+
+    IncrementalSVD<Complex<>> factor(12, 5, 1e-12l);
+    for (IndexType from = 0; from < 20; from += 4) {
+        factor.AppendColumns(matrix.GetSubmatrix({0, 12}, {from, from + 4}));
+    }
+
+    EXPECT_EQ(factor.Rank(), 3);
+    CheckOrthonormal(factor);
+    EXPECT_TRUE(AreEqualMatrices(factor.Reconstruct(), matrix));
+}
+
+TEST(TEST_INCREMENTAL_SVD, Stress) {
+    using Type = double;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 6; ++seed) {
+        MatrixGenerator gen(seed);
+
+        int32_t rows = gen.GetMatrixSize() / 2 + 5;
+        int32_t columns = gen.GetMatrixSize() / 2 + 5;
+        int32_t rank = gen.GetMatrixSize() % 5 + 1;
+        auto matrix = gen.GetLowRank(rows, columns, rank);
+
+        IncrementalSVD<Type> factor(rows, rank + 2, 1e-9);
+        for (IndexType from = 0; from < columns; from += 4) {
+            auto to = std::min<IndexType>(columns, from + 4);
+            factor.AppendColumns(matrix.GetSubmatrix({0, rows}, {from, to}));
+        }
+
+        EXPECT_EQ(factor.Rank(), rank);
+        CheckOrthonormal(factor);
+        EXPECT_TRUE(AreEqualMatrices(factor.Reconstruct(), matrix));
+    }
+}
+} // namespace
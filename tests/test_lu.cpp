@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/lu.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+template <MatrixType M, typename F>
+void CheckLU(const M &matrix, const F &factor) {
+    auto L = factor.GetL();
+    auto U = factor.GetU();
+
+    EXPECT_TRUE(IsUpperTriangular(U));
+    EXPECT_TRUE(IsUpperTriangular(decltype(L)::Transposed(L)));
+    EXPECT_TRUE(AreEqualMatrices(factor.GetP() * matrix, L * U));
+}
+
+TEST(TEST_LU, LUClear) {
+    Matrix<> matrix;
+
+    auto factor = LU(matrix);
+    EXPECT_TRUE(factor.pivots.empty());
+    EXPECT_FALSE(factor.IsSingular());
+}
+
+TEST(TEST_LU, LUSquare) {
+    Matrix<> matrix = {
+        {1, 2, 2, 4}, {6, 6, 7, 8}, {9, 10, 11, 11}, {12, 13, 14, 17}};
+
+    for (IndexType block = 1; block <= 4; ++block) {
+        auto factor = LU(matrix, block);
+        CheckLU(matrix, factor);
+        EXPECT_TRUE(AreEqualFloating(factor.Determinant(), 15.l));
+    }
+}
+
+TEST(TEST_LU, LURectangle) {
+    Matrix<> matrix = {{4, 4, 5}, {4, 1, 2}, {7, 9, 3}, {1, 1, 2}};
+
+    CheckLU(matrix, LU(matrix, 2));
+
+    auto transposed = Matrix<>::Transposed(matrix);
+    CheckLU(transposed, LU(transposed, 2));
+}
+
+TEST(TEST_LU, LUComplex) {
+    Matrix<Complex<>> matrix = {{{1, 2}, {3, 4}, {-1, 2}},
+                                {{7, -3}, {-3, 2}, {-5, -3}},
+                                {{-6, 3}, {0, -1}, {8, 9}}};
+
+    auto factor = LU(matrix);
+    CheckLU(matrix, factor);
+}
+
+TEST(TEST_LU, LUSingular) {
+    Matrix<> matrix = {{1, 2, 3}, {2, 4, 6}, {1, 0, 1}};
+
+    auto factor = LU(matrix);
+    CheckLU(matrix, factor);
+    EXPECT_TRUE(factor.IsSingular());
+    EXPECT_TRUE(AreEqualFloating(factor.Determinant(), 0.l));
+}
+
+TEST(TEST_LU, LUView) {
+    Matrix<> matrix = {
+        {1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}, {13, 14, 15, 17}};
+    auto view = matrix.GetSubmatrix({1, -1}, {0, -1});
+
+    CheckLU(view, LU(view));
+}
+
+TEST(TEST_LU, LUInPlace) {
+    RandomGenerator<double> gen(7);
+
+    auto matrix = gen.GetMatrix(150, 150);
+    auto copy = matrix;
+    const auto *storage = &matrix(0, 0);
+
+    auto factor = LU(std::move(matrix));
+    EXPECT_EQ(&factor.LU(0, 0), storage);
+    EXPECT_FALSE(factor.IsSingular());
+    CheckLU(copy, factor);
+}
+
+TEST(TEST_LU, Stress) {
+    using Type = Complex<long double>;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 10; ++seed) {
+        MatrixGenerator gen(seed);
+
+        int32_t rows = gen.GetMatrixSize();
+        int32_t columns = gen.GetMatrixSize();
+
+        auto matrix = gen.GetMatrix(rows, columns);
+        CheckLU(matrix, LU(matrix, 8));
+    }
+}
+} // namespace
@@ -146,6 +146,50 @@ TEST(TEST_MATRIX, Arithmetic) {
     CheckArithmeticMulti();
 }
 
+TEST(TEST_MATRIX, TemporaryArithmetic) {
+    using Matrix = Matrix<double>;
+
+    Matrix m1 = {{1, 2}, {3, 4}};
+    Matrix m2 = {{5, 6}, {7, 8}};
+
+    auto sum_temp = m1 * m2;
+    auto *sum_buffer = &sum_temp(0, 0);
+    auto sum = std::move(sum_temp) + m1;
+    EXPECT_EQ(&sum(0, 0), sum_buffer);
+    EXPECT_TRUE(sum == Matrix({{20, 24}, {46, 54}}));
+
+    auto diff_temp = m1 * m2;
+    auto *diff_buffer = &diff_temp(0, 0);
+    auto diff = m2 - std::move(diff_temp);
+    EXPECT_EQ(&diff(0, 0), diff_buffer);
+    EXPECT_TRUE(diff == Matrix({{-14, -16}, {-36, -42}}));
+
+    EXPECT_TRUE(m1 * m2 - m1 * m2 == Matrix(2, 2));
+    EXPECT_TRUE(m1 + m2 * m1 == Matrix({{24, 36}, {34, 50}}));
+    EXPECT_TRUE((m1 + m2) * 2.0 == Matrix({{12, 16}, {20, 24}}));
+    EXPECT_TRUE(0.5 * (m1 + m2) == Matrix({{3, 4}, {5, 6}}));
+    EXPECT_TRUE((m1 + m2) / 2.0 == Matrix({{3, 4}, {5, 6}}));
+
+    auto scaled_temp = m1 + m2;
+    auto *scaled_buffer = &scaled_temp(0, 0);
+    auto scaled = std::move(scaled_temp) * 3.0 / 2.0;
+    EXPECT_EQ(&scaled(0, 0), scaled_buffer);
+
+    using ComplexMatrix = LinearKit::Matrix<Complex<double>>;
+
+    Complex<double> unit = {0, 1};
+    ComplexMatrix complex = {{unit, 1}, {2, unit}};
+    auto conj = ComplexMatrix::Conjugated(complex * unit);
+    static_assert(std::is_same_v<decltype(conj), ComplexMatrix>);
+    EXPECT_TRUE(conj ==
+                ComplexMatrix({{{-1, 0}, {0, -2}}, {{0, -1}, {-1, 0}}}));
+
+    Matrix column = {{3}, {4}};
+    auto normalized = Matrix::Normalized(column * 2.0);
+    EXPECT_TRUE(AreEqualFloating(normalized(0, 0), 0.6));
+    EXPECT_TRUE(AreEqualFloating(normalized(1, 0), 0.8));
+}
+
 TEST(TEST_MATRIX, Transpose) {
     using Matrix = Matrix<float>;
 
@@ -169,6 +213,37 @@ TEST(TEST_MATRIX, Transpose) {
     }
 }
 
+TEST(TEST_MATRIX, TransposeTiles) {
+    using Matrix = Matrix<Complex<double>>;
+
+    // Sizes around the tile and the block boundaries.
+    for (auto [rows, cols] : {std::pair{1, 1}, {8, 8}, {9, 9}, {64, 64},
+                              {67, 67}, {1, 17}, {17, 1}, {8, 24}, {70, 9},
+                              {13, 130}}) {
+        Matrix matrix(rows, cols);
+        matrix.ApplyForEach([](Complex<double> &val, size_t i, size_t j) {
+            val = {static_cast<double>(i), static_cast<double>(j)};
+        });
+
+        auto transposed = matrix;
+        transposed.Transpose();
+        auto conjugated = matrix;
+        conjugated.Conjugate();
+
+        ASSERT_EQ(transposed.Rows(), cols);
+        ASSERT_EQ(conjugated.Columns(), rows);
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                EXPECT_EQ(transposed(j, i), matrix(i, j));
+                EXPECT_EQ(conjugated(j, i), std::conj(matrix(i, j)));
+            }
+        }
+
+        transposed.Transpose();
+        EXPECT_TRUE(transposed == matrix);
+    }
+}
+
 TEST(TEST_MATRIX, Conjugate) {
     using Matrix = Matrix<Complex<double>>;
 
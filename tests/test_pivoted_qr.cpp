@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/pivoted_qr.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+template <MatrixType M, typename F>
+void CheckPivotedQR(const M &matrix, const F &factor) {
+    auto Q = factor.GetQ();
+    auto R = factor.GetR();
+
+    EXPECT_TRUE(IsUnitary(Q));
+    EXPECT_TRUE(IsUpperTriangular(R));
+    EXPECT_TRUE(AreEqualMatrices(matrix * factor.GetP(), Q * R));
+
+    for (IndexType i = 0; i + 1 < factor.rank; ++i) {
+        EXPECT_GE(std::abs(R(i, i)) + 1e-10, std::abs(R(i + 1, i + 1)));
+    }
+}
+
+TEST(TEST_PIVOTED_QR, PivotedClear) {
+    Matrix<> matrix;
+
+    auto factor = PivotedQR(matrix);
+    EXPECT_EQ(factor.rank, 0);
+    EXPECT_TRUE(factor.permutation.empty());
+}
+
+TEST(TEST_PIVOTED_QR, PivotedOrder) {
+    Matrix<> matrix = {{1, 0, 3}, {0, 0, 4}, {0, 2, 0}};
+
+    for (IndexType block = 1; block <= 3; ++block) {
+        auto factor = PivotedQR(matrix, 0, -1, block);
+        CheckPivotedQR(matrix, factor);
+
+        EXPECT_EQ(factor.rank, 3);
+        EXPECT_EQ(factor.permutation, (std::vector<IndexType>{2, 1, 0}));
+        EXPECT_TRUE(AreEqualFloating(std::abs(factor.QR(0, 0)), 5.l));
+    }
+}
+
+TEST(TEST_PIVOTED_QR, PivotedRankDeficient) {
+    RandomGenerator<double> gen(3);
+    auto matrix = gen.GetLowRank(30, 20, 7);
+
+    for (IndexType block : {1, 4, 32}) {
+        auto factor = PivotedQR(matrix, 1e-10, -1, block);
+        CheckPivotedQR(matrix, factor);
+
+        EXPECT_EQ(factor.rank, 7);
+        EXPECT_LT(factor.residual, 1e-10);
+    }
+}
+
+TEST(TEST_PIVOTED_QR, PivotedTargetRank) {
+    RandomGenerator<double> gen(4);
+    auto matrix = gen.GetMatrix(25, 15) / 100.;
+
+    auto factor = PivotedQR(matrix, 0., 5, 2);
+    EXPECT_EQ(factor.rank, 5);
+    EXPECT_EQ(factor.tau.size(), 5);
+
+    // A * P - Q * R is Q times the dropped block.
+    auto difference = matrix * factor.GetP() - factor.GetQ() * factor.GetR();
+    for (IndexType j = 0; j < difference.Columns(); ++j) {
+        double norm = 0;
+        for (IndexType i = 0; i < difference.Rows(); ++i) {
+            norm += difference(i, j) * difference(i, j);
+        }
+        EXPECT_LE(std::sqrt(norm), factor.residual + 1e-8);
+    }
+    EXPECT_GT(factor.residual, 0.);
+}
+
+TEST(TEST_PIVOTED_QR, PivotedComplex) {
+    RandomGenerator<Complex<>> gen(5);
+    auto matrix = gen.GetLowRank(12, 16, 5);
+
+    auto factor = PivotedQR(matrix, 1e-12l, -1, 3);
+    CheckPivotedQR(matrix, factor);
+    EXPECT_EQ(factor.rank, 5);
+}
+
+TEST(TEST_PIVOTED_QR, PivotedView) {
+    Matrix<> matrix = {
+        {1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}, {13, 14, 15, 17}};
+    auto view = matrix.GetSubmatrix({1, -1}, {0, -1});
+
+    auto factor = PivotedQR(view, 1e-12l);
+    CheckPivotedQR(view, factor);
+    EXPECT_EQ(factor.rank, 3);
+}
+
+TEST(TEST_PIVOTED_QR, PivotedLeastSquares) {
+    // The last column repeats the first one, the basic solution keeps only
+    // one of them.
+    Matrix<> matrix = {{1, 0, 1}, {1, 1, 1}, {1, 2, 1}};
+    Matrix<> rhs = {{6}, {0}, {0}};
+
+    auto factor = PivotedQR(matrix, 1e-12l);
+    EXPECT_EQ(factor.rank, 2);
+
+    auto X = LeastSquares(factor, rhs);
+    EXPECT_TRUE(AreEqualFloating(X(0, 0) + X(2, 0), 5.l));
+    EXPECT_TRUE(AreEqualFloating(X(1, 0), -3.l));
+    EXPECT_TRUE(AreEqualFloating(X(0, 0) * X(2, 0), 0.l));
+}
+
+TEST(TEST_PIVOTED_QR, Stress) {
+    using Type = Complex<double>;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 10; ++seed) {
+        MatrixGenerator gen(seed);
+
+        int32_t rows = gen.GetMatrixSize();
+        int32_t columns = gen.GetMatrixSize();
+        auto matrix = gen.GetMatrix(rows, columns) / Type{100};
+
+        auto blocked = PivotedQR(matrix, 0., -1, 8);
+        auto classic = PivotedQR(matrix, 0., -1, 1);
+        CheckPivotedQR(matrix, blocked);
+        CheckPivotedQR(matrix, classic);
+
+        EXPECT_EQ(blocked.rank, std::min(rows, columns));
+    }
+}
+} // namespace
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/planar.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+
+using IndexType = LinearKit::Details::Types::IndexType;
+using LinearKit::PlanarMatrix;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::GetOrthogonalityError;
+using LinearKit::Tests::RandomGenerator;
+
+template <typename T>
+void CheckPlanarSVD(const Matrix<Complex<T>> &matrix) {
+    auto [U, S, VT, sweeps, is_converged] = JacobiSVD(PlanarMatrix(matrix));
+
+    EXPECT_TRUE(is_converged);
+    EXPECT_TRUE(IsUnitary(U));
+    EXPECT_TRUE(IsUnitary(VT));
+    EXPECT_LT(GetOrthogonalityError(U), 1e-13l);
+    EXPECT_LT(GetOrthogonalityError(VT), 1e-13l);
+
+    Matrix<Complex<T>> sigma(matrix.Rows(), matrix.Columns());
+    for (IndexType i = 0; i < S.Columns(); ++i) {
+        sigma(i, i) = S(0, i);
+        EXPECT_GE(std::real(S(0, i)), T{0});
+        if (i > 0) {
+            EXPECT_GE(std::real(S(0, i - 1)), std::real(S(0, i)));
+        }
+    }
+    EXPECT_TRUE(AreEqualMatrices(matrix, U * sigma * VT));
+}
+
+TEST(TEST_PLANAR, Layout) {
+    Matrix<Complex<double>> matrix = {{{1, 2}, {3, -4}}, {{0, 5}, {-6, 0}}};
+    PlanarMatrix planar(matrix);
+
+    EXPECT_EQ(planar.Rows(), 2);
+    EXPECT_EQ(planar.Columns(), 2);
+    EXPECT_EQ(planar.RealRow(1)[0], 0);
+    EXPECT_EQ(planar.ImagRow(0)[1], -4);
+    EXPECT_TRUE(planar.ToMatrix() == matrix);
+
+    planar.Set(1, 1, {7, 8});
+    EXPECT_EQ(planar(1, 1), Complex<double>(7, 8));
+
+    PlanarMatrix<double> clear;
+    EXPECT_TRUE(clear.ToMatrix() == Matrix<Complex<double>>{});
+}
+
+TEST(TEST_PLANAR, Gemm) {
+    using Type = Complex<double>;
+    RandomGenerator<Type> gen(11);
+
+    for (auto [rows, inner, cols] :
+         {std::tuple{1, 1, 1}, {3, 5, 2}, {17, 9, 33}, {40, 40, 40}}) {
+        auto A = gen.GetMatrix(rows, inner) / Type{100};
+        auto B = gen.GetMatrix(inner, cols) / Type{100};
+
+        auto C = PlanarGemm(PlanarMatrix(A), PlanarMatrix(B));
+        EXPECT_TRUE(AreEqualMatrices(C.ToMatrix(), A * B));
+    }
+
+    auto empty =
+        PlanarGemm(PlanarMatrix<double>(0, 3), PlanarMatrix<double>(3, 4));
+    EXPECT_EQ(empty.Rows(), 0);
+}
+
+TEST(TEST_PLANAR, JacobiSVD) {
+    using Type = Complex<long double>;
+    RandomGenerator<Type> gen(13);
+
+    for (auto [rows, cols] :
+         {std::pair{1, 1}, {4, 4}, {12, 5}, {5, 12}, {30, 20}}) {
+        CheckPlanarSVD(gen.GetMatrix(rows, cols) / Type{100});
+    }
+}
+
+TEST(TEST_PLANAR, JacobiRankDeficient) {
+    using Type = Complex<long double>;
+    RandomGenerator<Type> gen(17);
+
+    CheckPlanarSVD(Matrix<Type>(6, 4));
+
+    // Rank 2: only the first two singular values are not zero.
+    for (auto [rows, cols] : {std::pair{8, 6}, {6, 8}, {10, 10}}) {
+        auto matrix = gen.GetMatrix(rows, 2) / Type{100} *
+                      (gen.GetMatrix(2, cols) / Type{100});
+        CheckPlanarSVD(matrix);
+
+        auto [U, S, VT, sweeps, is_converged] =
+            JacobiSVD(PlanarMatrix(matrix));
+        EXPECT_GT(std::abs(S(0, 1)), 1e-10l);
+        for (IndexType i = 2; i < S.Columns(); ++i) {
+            EXPECT_LT(std::abs(S(0, i)), 1e-10l);
+        }
+    }
+}
+
+TEST(TEST_PLANAR, JacobiOrthogonalGraded) {
+    // The smallest singular value is below the rounding errors of the
+    // rotations, its column of U comes from the basis completion.
+    using Type = Complex<double>;
+    RandomGenerator<Type> gen(3);
+
+    for (int32_t size : {8, 64}) {
+        auto matrix = gen.GetBidiagonal(size, Type{1e-8});
+        auto [U, S, VT, sweeps, is_converged] =
+            JacobiSVD(PlanarMatrix(matrix));
+        EXPECT_TRUE(is_converged);
+        EXPECT_LT(GetOrthogonalityError(U), 1e-13);
+        EXPECT_LT(GetOrthogonalityError(VT), 1e-13);
+    }
+}
+
+TEST(TEST_PLANAR, Stress) {
+    using Type = Complex<long double>;
+
+    for (int32_t seed = 1; seed < 5; ++seed) {
+        RandomGenerator<Type> gen(seed);
+
+        for (int32_t it = 0; it < 3; ++it) {
+            auto rows = gen.GetMatrixSize();
+            auto cols = gen.GetMatrixSize();
+            CheckPlanarSVD(gen.GetMatrix(rows, cols) / Type{100});
+        }
+    }
+}
+} // namespace
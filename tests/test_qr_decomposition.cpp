@@ -14,6 +14,7 @@ using namespace LinearKit::Algorithm;
 using namespace LinearKit::Utils;
 using namespace LinearKit::MatrixUtils;
 using LinearKit::Tests::RandomGenerator;
+using IndexType = LinearKit::Details::Types::IndexType;
 
 template <MatrixType M, MatrixType F, MatrixType S>
 void CheckQR(const M &matrix, const F &Q, const S &R) {
@@ -184,6 +185,36 @@ TEST(TEST_QR_DECOMPOSITION, HessenbergView) {
     CheckQR(view, Q, R);
 }
 
+TEST(TEST_QR_DECOMPOSITION, CompactSquare) {
+    using Matrix = Matrix<long double>;
+
+    Matrix matrix = {{1, 2, 3}, {4, 5, 6}, {7, 8, 10}};
+
+    for (IndexType block = 1; block <= 3; ++block) {
+        auto factor = CompactQR(matrix, block);
+        CheckQR(matrix, factor.GetQ(block), factor.GetR());
+    }
+}
+
+TEST(TEST_QR_DECOMPOSITION, CompactRectangle) {
+    using Matrix = Matrix<Complex<long double>>;
+
+    RandomGenerator<Complex<long double>> gen(11);
+
+    for (auto [rows, cols] : {std::pair{17, 9}, {9, 17}, {1, 5}, {5, 1}}) {
+        auto matrix = gen.GetMatrix(rows, cols);
+        auto factor = CompactQR(matrix, 4);
+        auto Q = factor.GetQ();
+        CheckQR(matrix, Q, factor.GetR());
+
+        Matrix applied = matrix;
+        factor.ApplyQ(applied, true);
+        EXPECT_TRUE(AreEqualMatrices(applied, factor.GetR()));
+        factor.ApplyQ(applied, false);
+        EXPECT_TRUE(AreEqualMatrices(applied, matrix));
+    }
+}
+
 TEST(TEST_QR_DECOMPOSITION, Stress) {
     using Type = Complex<long double>;
     using MatrixGenerator = RandomGenerator<Type>;
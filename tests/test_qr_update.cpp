@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/qr_update.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+template <MatrixType M, typename F>
+void CheckUpdatedQR(const M &matrix, F &factor) {
+    using T = typename M::ElemType;
+
+    ASSERT_EQ(factor.Rows(), matrix.Rows());
+    ASSERT_EQ(factor.Columns(), matrix.Columns());
+
+    const auto &R = factor.GetR();
+    EXPECT_TRUE(IsUpperTriangular(R));
+
+    if (factor.IsTrackingQ()) {
+        EXPECT_TRUE(IsUnitary(factor.GetQ()));
+        EXPECT_TRUE(AreEqualMatrices(matrix, factor.GetQ() * R));
+    } else {
+        auto gram = Matrix<T>::Conjugated(matrix) * matrix;
+        EXPECT_TRUE(AreEqualMatrices(gram, Matrix<T>::Conjugated(R) * R));
+    }
+}
+
+template <typename T>
+Matrix<T> RemoveRows(const Matrix<T> &matrix, IndexType from,
+                     IndexType count) {
+    Matrix<T> result(matrix.Rows() - count, matrix.Columns());
+    for (IndexType i = 0; i < result.Rows(); ++i) {
+        auto source = (i < from) ? i : i + count;
+        for (IndexType j = 0; j < matrix.Columns(); ++j) {
+            result(i, j) = matrix(source, j);
+        }
+    }
+    return result;
+}
+
+TEST(TEST_QR_UPDATE, AppendRows) {
+    Matrix<> matrix = {{1, 2}, {3, 4}};
+    Matrix<> rows = {{5, 6}, {7, 9}};
+    Matrix<> full = {{1, 2}, {3, 4}, {5, 6}, {7, 9}};
+
+    UpdatableQR factor(matrix);
+    factor.AppendRows(rows);
+    CheckUpdatedQR(full, factor);
+}
+
+TEST(TEST_QR_UPDATE, InsertRows) {
+    RandomGenerator<double> gen(2);
+    auto matrix = gen.GetMatrix(6, 4) / 100.;
+    auto rows = gen.GetMatrix(3, 4) / 100.;
+
+    Matrix<double> full(9, 4);
+    for (IndexType i = 0; i < 9; ++i) {
+        for (IndexType j = 0; j < 4; ++j) {
+            full(i, j) = (i < 2)   ? matrix(i, j)
+                         : (i < 5) ? rows(i - 2, j)
+                                   : matrix(i - 3, j);
+        }
+    }
+
+    UpdatableQR factor(matrix);
+    factor.InsertRows(2, rows);
+    CheckUpdatedQR(full, factor);
+}
+
+TEST(TEST_QR_UPDATE, DeleteRows) {
+    RandomGenerator<double> gen(3);
+    auto matrix = gen.GetMatrix(8, 5) / 100.;
+
+    UpdatableQR factor(matrix);
+    factor.DeleteRows(2, 3);
+    CheckUpdatedQR(RemoveRows(matrix, 2, 3), factor);
+
+    factor.DeleteRows(0);
+    CheckUpdatedQR(RemoveRows(RemoveRows(matrix, 2, 3), 0, 1), factor);
+}
+
+TEST(TEST_QR_UPDATE, InsertColumn) {
+    RandomGenerator<Complex<>> gen(4);
+    auto matrix = gen.GetMatrix(7, 4) / Complex<>{100};
+    auto column = gen.GetMatrix(7, 1) / Complex<>{100};
+
+    Matrix<Complex<>> full(7, 5);
+    for (IndexType i = 0; i < 7; ++i) {
+        for (IndexType j = 0; j < 5; ++j) {
+            full(i, j) = (j < 1) ? matrix(i, j)
+                         : (j == 1) ? column(i, 0)
+                                    : matrix(i, j - 1);
+        }
+    }
+
+    UpdatableQR factor(matrix);
+    factor.InsertColumn(1, column);
+    CheckUpdatedQR(full, factor);
+}
+
+TEST(TEST_QR_UPDATE, DeleteColumn) {
+    Matrix<> matrix = {{1, 2, 3}, {4, 5, 6}, {7, 8, 10}, {1, 0, 1}};
+    Matrix<> expected = {{1, 3}, {4, 6}, {7, 10}, {1, 1}};
+
+    for (bool track_q : {true, false}) {
+        UpdatableQR factor(matrix, track_q);
+        factor.DeleteColumn(1);
+        CheckUpdatedQR(expected, factor);
+    }
+}
+
+TEST(TEST_QR_UPDATE, RankOneUpdate) {
+    RandomGenerator<Complex<>> gen(5);
+    auto matrix = gen.GetMatrix(6, 4) / Complex<>{100};
+    auto u = gen.GetMatrix(6, 1) / Complex<>{100};
+    auto v = gen.GetMatrix(4, 1) / Complex<>{100};
+
+    UpdatableQR factor(matrix);
+    factor.RankOneUpdate(u, v);
+
+    auto expected = matrix;
+    for (IndexType i = 0; i < 6; ++i) {
+        for (IndexType j = 0; j < 4; ++j) {
+            expected(i, j) += u(i, 0) * std::conj(v(j, 0));
+        }
+    }
+    CheckUpdatedQR(expected, factor);
+}
+
+TEST(TEST_QR_UPDATE, StreamingWithoutQ) {
+    RandomGenerator<double> gen(6);
+
+    auto matrix = gen.GetMatrix(3, 5) / 100.;
+    UpdatableQR factor(matrix, false);
+    EXPECT_EQ(factor.GetR().Rows(), 3);
+
+    for (IndexType batch = 0; batch < 20; ++batch) {
+        auto rows = gen.GetMatrix(4, 5) / 100.;
+        factor.AppendRows(rows);
+
+        Matrix<double> full(matrix.Rows() + 4, 5);
+        for (IndexType i = 0; i < full.Rows(); ++i) {
+            for (IndexType j = 0; j < 5; ++j) {
+                full(i, j) = (i < matrix.Rows())
+                                 ? matrix(i, j)
+                                 : rows(i - matrix.Rows(), j);
+            }
+        }
+        matrix = std::move(full);
+    }
+
+    EXPECT_EQ(factor.GetR().Rows(), 5);
+    CheckUpdatedQR(matrix, factor);
+}
+
+TEST(TEST_QR_UPDATE, StreamingWithQ) {
+    // Batches at both ends, with Q built in the middle of the stream.
+    RandomGenerator<double> gen(8);
+
+    auto matrix = gen.GetMatrix(4, 3) / 100.;
+    UpdatableQR factor(matrix);
+
+    for (IndexType batch = 0; batch < 12; ++batch) {
+        auto rows = gen.GetMatrix(2, 3) / 100.;
+        auto position = (batch % 3 == 0) ? IndexType{0} : matrix.Rows();
+        factor.InsertRows(position, rows);
+
+        Matrix<double> full(matrix.Rows() + 2, 3);
+        for (IndexType i = 0; i < full.Rows(); ++i) {
+            for (IndexType j = 0; j < 3; ++j) {
+                full(i, j) = (i < position)       ? matrix(i, j)
+                             : (i < position + 2) ? rows(i - position, j)
+                                                  : matrix(i - 2, j);
+            }
+        }
+        matrix = std::move(full);
+
+        if (batch == 5) {
+            CheckUpdatedQR(matrix, factor);
+        }
+    }
+
+    CheckUpdatedQR(matrix, factor);
+}
+
+TEST(TEST_QR_UPDATE, Stress) {
+    using Type = Complex<double>;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 10; ++seed) {
+        MatrixGenerator gen(seed);
+
+        int32_t rows = gen.GetMatrixSize() / 4 + 2;
+        int32_t columns = gen.GetMatrixSize() / 4 + 2;
+        auto matrix = gen.GetMatrix(rows, columns) / Type{100};
+
+        UpdatableQR factor(matrix);
+
+        auto u = gen.GetMatrix(rows, 1) / Type{100};
+        auto v = gen.GetMatrix(columns, 1) / Type{100};
+        factor.RankOneUpdate(u, v);
+        for (IndexType i = 0; i < rows; ++i) {
+            for (IndexType j = 0; j < columns; ++j) {
+                matrix(i, j) += u(i, 0) * std::conj(v(j, 0));
+            }
+        }
+
+        auto extra = gen.GetMatrix(3, columns) / Type{100};
+        factor.AppendRows(extra);
+        factor.DeleteRows(0, 2);
+
+        Matrix<Type> expected(rows + 1, columns);
+        for (IndexType i = 0; i < rows + 1; ++i) {
+            for (IndexType j = 0; j < columns; ++j) {
+                expected(i, j) = (i + 2 < rows) ? matrix(i + 2, j)
+                                                : extra(i + 2 - rows, j);
+            }
+        }
+
+        factor.DeleteColumn(columns - 1);
+        CheckUpdatedQR(expected.GetSubmatrix({0, rows + 1}, {0, columns - 1}),
+                       factor);
+    }
+}
+} // namespace
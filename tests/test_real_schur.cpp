@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/real_schur.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+#include <algorithm>
+
+namespace {
+template <typename T = double>
+using Complex = std::complex<T>;
+
+template <typename T = double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+template <MatrixType M, MatrixType F, MatrixType S>
+void CheckSchur(const M &matrix, const F &Q, const S &T) {
+    EXPECT_TRUE(AreEqualMatrices(Matrix<double>::Transposed(Q) * Q,
+                                 Matrix<double>::Identity(Q.Rows())));
+    EXPECT_TRUE(IsQuasiUpperTriangular(T));
+    EXPECT_TRUE(
+        AreEqualMatrices(matrix, Q * T * Matrix<double>::Transposed(Q)));
+}
+
+template <MatrixType M>
+void CheckEigenvectors(const M &matrix,
+                       const std::vector<Complex<>> &eigenvalues,
+                       const Matrix<double> &X) {
+    for (IndexType k = 0; k < matrix.Rows(); ++k) {
+        std::vector<Complex<>> x(matrix.Rows());
+        for (IndexType i = 0; i < matrix.Rows(); ++i) {
+            if (eigenvalues[k].imag() == 0) {
+                x[i] = X(i, k);
+            } else if (eigenvalues[k].imag() > 0) {
+                x[i] = {X(i, k), X(i, k + 1)};
+            } else {
+                x[i] = {X(i, k - 1), -X(i, k)};
+            }
+        }
+
+        for (IndexType i = 0; i < matrix.Rows(); ++i) {
+            Complex<> sum = 0;
+            for (IndexType j = 0; j < matrix.Columns(); ++j) {
+                sum += matrix(i, j) * x[j];
+            }
+            EXPECT_TRUE(AreEqualFloating(sum, eigenvalues[k] * x[i]));
+        }
+    }
+}
+
+std::vector<Complex<>> Sorted(std::vector<Complex<>> values) {
+    std::sort(values.begin(), values.end(), [](auto lhs, auto rhs) {
+        return std::pair{lhs.real(), lhs.imag()} <
+               std::pair{rhs.real(), rhs.imag()};
+    });
+    return values;
+}
+
+TEST(TEST_REAL_SCHUR, SchurClear) {
+    Matrix<> matrix;
+
+    auto [T, Q, eigenvalues, is_converged] = GetRealSchurForm(matrix);
+    EXPECT_EQ(T.Rows(), 0);
+    EXPECT_TRUE(eigenvalues.empty());
+    EXPECT_TRUE(is_converged);
+}
+
+TEST(TEST_REAL_SCHUR, SchurRotation) {
+    Matrix<> matrix = {{0, -1}, {1, 0}};
+
+    auto schur = GetRealSchurForm(matrix);
+    CheckSchur(matrix, schur.Q, schur.S);
+
+    auto eigenvalues = Sorted(schur.eigenvalues);
+    EXPECT_TRUE(AreEqualFloating(eigenvalues[0], Complex<>{0, -1}));
+    EXPECT_TRUE(AreEqualFloating(eigenvalues[1], Complex<>{0, 1}));
+
+    CheckEigenvectors(matrix, schur.eigenvalues, GetRealEigenvectors(schur));
+}
+
+TEST(TEST_REAL_SCHUR, SchurCompanion) {
+    // Roots of x^4 - x^3 + x^2 - 11x + 10: 1, 2, -1 +- 2i.
+    Matrix<> matrix = {
+        {1, -1, 11, -10}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}};
+
+    auto schur = GetRealSchurForm(matrix);
+    CheckSchur(matrix, schur.Q, schur.S);
+
+    auto eigenvalues = Sorted(schur.eigenvalues);
+    std::vector<Complex<>> expected = {{-1, -2}, {-1, 2}, {1, 0}, {2, 0}};
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_TRUE(AreEqualFloating(eigenvalues[i], expected[i]));
+    }
+
+    CheckEigenvectors(matrix, schur.eigenvalues, GetRealEigenvectors(schur));
+}
+
+TEST(TEST_REAL_SCHUR, SchurView) {
+    Matrix<> matrix = {
+        {1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}, {13, 14, 15, 17}};
+    auto view = matrix.GetSubmatrix({1, -1}, {1, -1});
+
+    auto schur = GetRealSchurForm(view);
+    CheckSchur(view, schur.Q, schur.S);
+    CheckEigenvectors(view, schur.eigenvalues, GetRealEigenvectors(schur));
+}
+
+TEST(TEST_REAL_SCHUR, Stress) {
+    using MatrixGenerator = RandomGenerator<double>;
+
+    for (int32_t seed = 1; seed < 10; ++seed) {
+        MatrixGenerator gen(seed);
+
+        int32_t size = gen.GetMatrixSize();
+        auto matrix = gen.GetMatrix(size, size);
+
+        auto schur = GetRealSchurForm(matrix);
+        EXPECT_TRUE(schur.is_converged);
+        CheckSchur(matrix, schur.Q, schur.S);
+        CheckEigenvectors(matrix, schur.eigenvalues,
+                          GetRealEigenvectors(schur));
+    }
+}
+
+TEST(TEST_REAL_SCHUR, DeflationWindow) {
+    RandomGenerator<double> gen(2024);
+
+    auto matrix = gen.GetMatrix(120, 120);
+
+    auto schur = GetRealSchurForm(matrix);
+    CheckSchur(matrix, schur.Q, schur.S);
+    CheckEigenvectors(matrix, schur.eigenvalues, GetRealEigenvectors(schur));
+}
+
+TEST(TEST_REAL_SCHUR, IterationLimit) {
+    RandomGenerator<double> gen(7);
+    auto matrix = gen.GetMatrix(12, 12);
+
+    auto schur = GetRealSchurForm(matrix, 0);
+    EXPECT_FALSE(schur.is_converged);
+    EXPECT_TRUE(
+        AreEqualMatrices(matrix, schur.Q * schur.S *
+                                     Matrix<double>::Transposed(schur.Q)));
+    EXPECT_FALSE(IsQuasiUpperTriangular(schur.S));
+
+    EXPECT_TRUE(GetRealSchurForm(matrix).is_converged);
+}
+} // namespace
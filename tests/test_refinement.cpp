@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/refinement.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+template <typename T>
+T GetMaxResidual(const Matrix<T> &A, const Matrix<T> &X, const Matrix<T> &B) {
+    T result = 0;
+    LinearKit::Algorithm::Details::GetResidual(A, X, B).ForEach(
+        [&](const T &value) { result = std::max(result, std::abs(value)); });
+    return result;
+}
+
+TEST(TEST_REFINEMENT, WorkingPrecision) {
+    RandomGenerator<double> gen(31);
+
+    for (auto factorization : {RefinementFactor::LU, RefinementFactor::QR}) {
+        for (IndexType size : {1, 7, 40, 130}) {
+            auto A = gen.GetMatrix(size, size) / 100.0;
+            for (IndexType i = 0; i < size; ++i) {
+                A(i, i) += 2.0;
+            }
+            auto B = gen.GetMatrix(size, 3) / 100.0;
+
+            auto [X, steps, is_refined] = RefinedSolve(A, B, factorization);
+            EXPECT_TRUE(is_refined);
+            EXPECT_GT(steps, 0);
+
+            // The float solution alone is good to 1e-7 only.
+            auto low = Solve(LU(CastMatrix<float>(A)), CastMatrix<float>(B));
+            EXPECT_GT(GetMaxResidual(A, CastMatrix<double>(low), B), 1e-9);
+            EXPECT_LT(GetMaxResidual(A, X, B), 1e-12);
+        }
+    }
+}
+
+TEST(TEST_REFINEMENT, LongDouble) {
+    RandomGenerator<long double> gen(33);
+    auto A = gen.GetMatrix(50, 50) / 100.0l;
+    for (IndexType i = 0; i < 50; ++i) {
+        A(i, i) += 2.0l;
+    }
+    auto B = gen.GetMatrix(50, 2) / 100.0l;
+
+    auto [X, steps, is_refined] = RefinedSolve<double>(A, B);
+    EXPECT_TRUE(is_refined);
+    EXPECT_LT(GetMaxResidual(A, X, B), 1e-17l);
+}
+
+TEST(TEST_REFINEMENT, Fallback) {
+    // cond(A) ~ 1.7e16 is beyond float: the refinement stagnates.
+    IndexType size = 12;
+    Matrix<double> hilbert(size, size);
+    hilbert.ApplyForEach([](double &value, auto i, auto j) {
+        value = 1.0 / static_cast<double>(i + j + 1);
+    });
+    Matrix<double> B(size, 1);
+    B.ApplyForEach([](double &value) { value = 1.0; });
+
+    auto solution = RefinedSolve(hilbert, B);
+    EXPECT_FALSE(solution.is_refined);
+    // The attempted steps are kept.
+    EXPECT_GT(solution.steps, 0);
+    EXPECT_LT(GetMaxResidual(hilbert, solution.X, B), 1e-6);
+
+    // Does not fit into float.
+    Matrix<double> huge = {{1e300, 0}, {0, 1}};
+    auto large = RefinedSolve(huge, Matrix<double>{{1e300}, {2}});
+    EXPECT_FALSE(large.is_refined);
+    EXPECT_EQ(large.steps, 0);
+    EXPECT_DOUBLE_EQ(large.X(0, 0), 1);
+    EXPECT_DOUBLE_EQ(large.X(1, 0), 2);
+}
+} // namespace
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/solve.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+TEST(TEST_SOLVE, SolveLU) {
+    Matrix<> matrix = {{2, 1, 1}, {4, -6, 0}, {-2, 7, 2}};
+    Matrix<> rhs = {{5, 1}, {-2, 0}, {9, 0}};
+
+    auto X = Solve(LU(matrix), rhs);
+    EXPECT_TRUE(AreEqualMatrices(matrix * X, rhs));
+    EXPECT_TRUE(AreEqualFloating(X(0, 0), 1.l));
+    EXPECT_TRUE(AreEqualFloating(X(1, 0), 1.l));
+    EXPECT_TRUE(AreEqualFloating(X(2, 0), 2.l));
+}
+
+TEST(TEST_SOLVE, SolveCholesky) {
+    Matrix<Complex<>> matrix = {{{4, 0}, {2, 2}, {0, -2}},
+                                {{2, -2}, {6, 0}, {1, 1}},
+                                {{0, 2}, {1, -1}, {5, 0}}};
+    Matrix<Complex<>> rhs = {{{1, 0}}, {{0, 1}}, {{2, -1}}};
+
+    auto X = Solve(Cholesky(matrix), rhs);
+    EXPECT_TRUE(AreEqualMatrices(matrix * X, rhs));
+}
+
+TEST(TEST_SOLVE, SolveQR) {
+    RandomGenerator<Complex<>> gen(5);
+
+    auto matrix = gen.GetWellConditioned(30, 30);
+    auto rhs = gen.GetMatrix(30, 70) / Complex<>{100};
+
+    auto X = Solve(CompactQR(matrix, 8), rhs);
+    EXPECT_TRUE(AreEqualMatrices(matrix * X, rhs));
+}
+
+TEST(TEST_SOLVE, SolveView) {
+    RandomGenerator<double> gen(9);
+
+    auto matrix = gen.GetWellConditioned(100, 100);
+    auto rhs = gen.GetMatrix(100, 150) / 100.;
+
+    Matrix<double> storage(110, 160);
+    auto view = storage.GetSubmatrix({5, 105}, {3, 153});
+    view += rhs;
+
+    auto factor = LU(matrix);
+    SolveInPlace(factor, view);
+
+    EXPECT_TRUE(AreEqualMatrices(matrix * view, rhs));
+    EXPECT_EQ(storage(0, 0), 0.);
+    EXPECT_EQ(storage(109, 159), 0.);
+}
+
+TEST(TEST_SOLVE, LeastSquares) {
+    using Matrix = Matrix<Complex<>>;
+
+    RandomGenerator<Complex<>> gen(3);
+
+    auto matrix = gen.GetWellConditioned(40, 12);
+    auto rhs = gen.GetMatrix(40, 5) / Complex<>{100};
+
+    auto X = LeastSquares(CompactQR(matrix, 5), rhs);
+    ASSERT_EQ(X.Rows(), 12);
+
+    // The residual is orthogonal to the range of the matrix.
+    auto residual = matrix * X - rhs;
+    EXPECT_TRUE(AreEqualMatrices(Matrix::Conjugated(matrix) * residual,
+                                 Matrix(12, 5)));
+}
+
+TEST(TEST_SOLVE, MinNorm) {
+    using Matrix = Matrix<Complex<>>;
+
+    RandomGenerator<Complex<>> gen(4);
+
+    auto matrix = gen.GetWellConditioned(10, 35);
+    auto rhs = gen.GetMatrix(10, 4) / Complex<>{100};
+
+    auto X = MinNorm(CompactQR(Matrix::Conjugated(matrix)), rhs);
+    ASSERT_EQ(X.Rows(), 35);
+    EXPECT_TRUE(AreEqualMatrices(matrix * X, rhs));
+
+    // The least norm solution is A^H * (A * A^H)^-1 * B.
+    auto gram = matrix * Matrix::Conjugated(matrix);
+    auto expected = Matrix::Conjugated(matrix) * Solve(Cholesky(gram), rhs);
+    EXPECT_TRUE(AreEqualMatrices(X, expected));
+}
+
+TEST(TEST_SOLVE, Stress) {
+    using Type = Complex<long double>;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 10; ++seed) {
+        MatrixGenerator gen(seed);
+
+        int32_t size = gen.GetMatrixSize();
+        int32_t rhs_cnt = gen.GetMatrixSize() + 1;
+
+        auto matrix = gen.GetWellConditioned(size, size);
+        auto rhs = gen.GetMatrix(size, rhs_cnt) / Type{100};
+
+        EXPECT_TRUE(AreEqualMatrices(matrix * Solve(LU(matrix, 8), rhs), rhs));
+        EXPECT_TRUE(
+            AreEqualMatrices(matrix * Solve(CompactQR(matrix, 8), rhs), rhs));
+    }
+}
+} // namespace
@@ -78,9 +78,33 @@ TEST(TEST_SPECTRAL, Stress) {
         for (size_t it = 0; it < it_count; ++it) {
             int32_t size = gen.GetMatrixSize();
             auto matrix = gen.GetSymmetricMatrix(size);
-            auto [D, Q] = GetSpecDecomposition(matrix);
+            auto [D, Q, is_converged] = GetCheckedSpecDecomposition(matrix);
+            EXPECT_TRUE(is_converged);
             CheckSpectral(matrix, D, Q);
         }
     }
 }
+
+TEST(TEST_SPECTRAL, IterationLimit) {
+    RandomGenerator<long double> gen(5);
+    auto matrix = gen.GetSymmetricMatrix(20);
+
+    auto [D, Q, is_converged] = GetCheckedSpecDecomposition(matrix, 0, 0);
+    EXPECT_FALSE(is_converged);
+    EXPECT_FALSE(IsDiagonal(D));
+
+    Matrix<Complex<long double>> complex = {{{2, 0}, {1, 1}},
+                                            {{1, 1}, {3, 0}}};
+    EXPECT_FALSE(GetCheckedSpecDecomposition(complex, {0, 0}, 0).is_converged);
+}
+
+TEST(TEST_SPECTRAL, RealShiftIgnored) {
+    RandomGenerator<long double> gen(7);
+    auto matrix = gen.GetSymmetricMatrix(20);
+
+    // The shift goes to the shift parameter, not to the iteration limit.
+    auto [D, Q] = GetSpecDecomposition(matrix, 0.5l);
+    EXPECT_TRUE(IsDiagonal(D));
+    CheckSpectral(matrix, D, Q);
+}
 } // namespace
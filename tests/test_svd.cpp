@@ -14,6 +14,7 @@ using IndexType = LinearKit::Details::Types::IndexType;
 using namespace LinearKit::Algorithm;
 using namespace LinearKit::Utils;
 using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::GetOrthogonalityError;
 using LinearKit::Tests::RandomGenerator;
 using LinearKit::Utils::Details::IsFloatComplexT;
 
@@ -128,6 +129,233 @@ TEST(TEST_SVD, SVDView) {
     CheckSVD(view, U, S, VT);
 }
 
+TEST(TEST_SVD, JacobiSquare) {
+    using Matrix = Matrix<long double>;
+
+    {
+        Matrix matrix = {
+            {1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}, {13, 14, 15, 16}};
+
+        auto [U, S, VT] = SVD(matrix, SVDEngine::Jacobi);
+        CheckSVD(matrix, U, S, VT);
+    }
+    {
+        for (int32_t i = 1; i <= 40; i += 3) {
+            auto matrix = generator.GetMatrix(i, i);
+            auto [U, S, VT] = SVD(matrix, SVDEngine::Jacobi);
+            CheckSVD(matrix, U, S, VT);
+        }
+    }
+}
+
+TEST(TEST_SVD, JacobiRectangle) {
+    for (int32_t i = 1; i <= 12; i += 2) {
+        for (int32_t j = 1; j <= 12; j += 3) {
+            auto matrix = generator.GetMatrix(i, j);
+            auto [U, S, VT, sweeps, is_converged] = JacobiSVD(matrix);
+            CheckSVD(matrix, U, S, VT);
+        }
+    }
+}
+
+TEST(TEST_SVD, JacobiComplex) {
+    using Type = Complex<long double>;
+    RandomGenerator<Type> gen(4242);
+
+    for (int32_t size = 2; size <= 40; size += 19) {
+        auto matrix = gen.GetMatrix(size + 3, size);
+        auto [U, S, VT] = SVD(matrix, SVDEngine::Jacobi);
+        CheckSVD(matrix, U, S, VT);
+    }
+}
+
+TEST(TEST_SVD, JacobiRelativeAccuracy) {
+    // A = D1 * B * D2 with a well-conditioned B and the singular values from
+    // 1 down to 1e-25. The reference is the same method in long double.
+    RandomGenerator<double> gen(7);
+    IndexType size = 6;
+    auto B = Matrix<double>::Identity(size) + gen.GetMatrix(size, size) / 400.;
+
+    Matrix<double> matrix(size, size);
+    for (IndexType i = 0; i < size; ++i) {
+        for (IndexType j = 0; j < size; ++j) {
+            matrix(i, j) = std::pow(10., -3. * i) * B(i, j) *
+                           std::pow(10., -2. * j);
+        }
+    }
+
+    auto [U, S, VT, sweeps, is_converged] = JacobiSVD(matrix);
+    auto reference = JacobiSVD(CastMatrix<long double>(matrix));
+    auto bidiag = SVD(matrix, SVDEngine::BidiagQR);
+
+    EXPECT_TRUE(is_converged);
+    EXPECT_LT(sweeps, 30);
+    EXPECT_LT(reference.S(0, size - 1), 1e-24);
+    for (IndexType i = 0; i < size; ++i) {
+        EXPECT_NEAR(S(0, i) / reference.S(0, i), 1., 1e-14);
+    }
+
+    // The normwise accurate bidiagonal QR loses the small ones.
+    EXPECT_GT(std::abs(bidiag.S(0, size - 1) / reference.S(0, size - 1) - 1),
+              1e-2);
+}
+
+TEST(TEST_SVD, JacobiOrthogonalGraded) {
+    // The diagonal is 1e-8 of the superdiagonal: the smallest singular value
+    // is below the rounding errors of the rotations and its column of U comes
+    // from the basis completion.
+    RandomGenerator<double> gen(3);
+
+    for (int32_t size : {8, 64}) {
+        auto matrix = gen.GetBidiagonal(size, 1e-8);
+        auto [U, S, VT, sweeps, is_converged] = JacobiSVD(matrix);
+        EXPECT_TRUE(is_converged);
+        EXPECT_LT(GetOrthogonalityError(U), 1e-13);
+        EXPECT_LT(GetOrthogonalityError(VT), 1e-13);
+
+        // The product of the factors in double rounds the 1e-10 entries off.
+        auto wide_matrix = CastMatrix<long double>(matrix);
+        auto wide = JacobiSVD(wide_matrix);
+        EXPECT_LT(GetOrthogonalityError(wide.U), 1e-13l);
+        EXPECT_LT(GetOrthogonalityError(wide.VT), 1e-13l);
+        CheckSVD(wide_matrix, wide.U, wide.S, wide.VT);
+    }
+}
+
+TEST(TEST_SVD, JacobiOrthogonalRankDeficient) {
+    RandomGenerator<double> gen(5);
+
+    auto zero = JacobiSVD(Matrix<double>(12, 8));
+    EXPECT_LT(GetOrthogonalityError(zero.U), 1e-13);
+    EXPECT_LT(GetOrthogonalityError(zero.VT), 1e-13);
+
+    for (auto [rows, cols, rank] :
+         {std::tuple{40, 30, 10}, {30, 40, 7}, {50, 50, 49}}) {
+        auto matrix = gen.GetMatrix(rows, rank) / 100. *
+                      (gen.GetMatrix(rank, cols) / 100.);
+        auto [U, S, VT, sweeps, is_converged] = JacobiSVD(matrix);
+        EXPECT_TRUE(is_converged);
+        EXPECT_LT(GetOrthogonalityError(U), 1e-13);
+        EXPECT_LT(GetOrthogonalityError(VT), 1e-13);
+        CheckSVD(matrix, U, S, VT);
+    }
+}
+
+TEST(TEST_SVD, JacobiSweepLimit) {
+    auto matrix = generator.GetMatrix(10, 8);
+
+    auto [U, S, VT, sweeps, is_converged] = JacobiSVD(matrix, 1);
+    EXPECT_EQ(sweeps, 1);
+    EXPECT_FALSE(is_converged);
+
+    auto converged = JacobiSVD(matrix);
+    EXPECT_TRUE(converged.is_converged);
+    EXPECT_GT(converged.sweeps, 1);
+}
+
+TEST(TEST_SVD, DivideConquerSquare) {
+    for (int32_t i = 1; i <= 70; i += 7) {
+        auto matrix = generator.GetMatrix(i, i);
+        auto [U, S, VT] = SVD(matrix, SVDEngine::DivideAndConquer);
+        CheckSVD(matrix, U, S, VT);
+    }
+}
+
+TEST(TEST_SVD, DivideConquerRectangle) {
+    for (int32_t i = 20; i <= 60; i += 20) {
+        for (int32_t j = 17; j <= 57; j += 20) {
+            auto matrix = generator.GetMatrix(i, j);
+            auto [U, S, VT] = SVD(matrix, SVDEngine::DivideAndConquer);
+            CheckSVD(matrix, U, S, VT);
+        }
+    }
+}
+
+TEST(TEST_SVD, DivideConquerComplex) {
+    using Type = Complex<long double>;
+    RandomGenerator<Type> gen(777);
+
+    auto matrix = gen.GetMatrix(45, 38);
+    auto [U, S, VT] = SVD(matrix, SVDEngine::DivideAndConquer);
+    CheckSVD(matrix, U, S, VT);
+}
+
+TEST(TEST_SVD, DivideConquerDeflation) {
+    using Matrix = Matrix<long double>;
+
+    for (int32_t size : {17, 40, 64}) {
+        Matrix bidiag(size, size);
+        for (int32_t i = 0; i < size; ++i) {
+            bidiag(i, i) = (i % 3 == 0) ? 0.l : 1.l;
+            if (i + 1 < size) {
+                bidiag(i, i + 1) = (i % 5 == 0) ? 0.l : 1.l;
+            }
+        }
+
+        auto [U, D, VT] = BidiagDivideConquer(bidiag);
+        EXPECT_TRUE(IsUnitary(U, 1e-10l));
+        EXPECT_TRUE(IsUnitary(VT, 1e-10l));
+        EXPECT_TRUE(IsDiagonal(D));
+        EXPECT_TRUE(AreEqualMatrices(bidiag, U * D * VT, 1e-10l));
+    }
+}
+
+template <typename T>
+void CheckBidiagDivideConquer(const Matrix<T> &bidiag) {
+    auto [U, D, VT] = BidiagDivideConquer(bidiag);
+    EXPECT_LT(GetOrthogonalityError(U), 1e-13l);
+    EXPECT_LT(GetOrthogonalityError(VT), 1e-13l);
+    EXPECT_TRUE(IsDiagonal(D));
+    EXPECT_TRUE(AreEqualMatrices(bidiag, U * D * VT, T{1e-13l}));
+}
+
+TEST(TEST_SVD, DivideConquerClustered) {
+    // All the poles of the merges are within 1e-12 of each other.
+    RandomGenerator<long double> gen(11);
+
+    for (int32_t size : {17, 100}) {
+        auto bidiag = gen.GetBidiagonal(size);
+        for (int32_t i = 0; i < size; ++i) {
+            bidiag(i, i) = 1.l;
+            if (i + 1 < size) {
+                bidiag(i, i + 1) *= 1e-12l;
+            }
+        }
+        CheckBidiagDivideConquer(bidiag);
+    }
+}
+
+TEST(TEST_SVD, DivideConquerGraded) {
+    RandomGenerator<long double> gen(13);
+
+    for (int32_t size : {40, 300}) {
+        auto bidiag = gen.GetBidiagonal(size);
+        for (int32_t i = 0; i < size; ++i) {
+            bidiag(i, i) = std::pow(10.l, -20.l * i / size);
+        }
+        CheckBidiagDivideConquer(bidiag);
+    }
+}
+
+TEST(TEST_SVD, DivideConquerSmallCoupling) {
+    // Zero diagonal entries and a superdiagonal of 1e-12: the last root of
+    // a merge is within 1e-24 of its pole.
+    RandomGenerator<long double> gen(17);
+
+    for (int32_t size : {17, 40, 150}) {
+        auto bidiag = gen.GetBidiagonal(size);
+        for (int32_t i = 0; i < size; ++i) {
+            if (i % 4 == 0) {
+                bidiag(i, i) = 0.l;
+            }
+            if (i + 1 < size) {
+                bidiag(i, i + 1) *= (i % 7 == 0) ? 0.l : 1e-12l;
+            }
+        }
+        CheckBidiagDivideConquer(bidiag);
+    }
+}
+
 TEST(TEST_SVD, Stress) {
     using Type = Complex<long double>;
     using MatrixGenerator = RandomGenerator<Type>;
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/tsqr.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+template <MatrixType M, typename F>
+void CheckTSQR(const M &matrix, const F &factor) {
+    using T = typename M::ElemType;
+
+    auto Q = factor.GetQ();
+    auto R = factor.GetR();
+
+    EXPECT_TRUE(IsUpperTriangular(R));
+    EXPECT_TRUE(AreEqualMatrices(matrix, Q * R));
+
+    auto QHQ = Matrix<T>::Conjugated(Q) * Q;
+    EXPECT_TRUE(AreEqualMatrices(QHQ, Matrix<T>::Identity(factor.Rank())));
+}
+
+TEST(TEST_TSQR, TSQRClear) {
+    Matrix<> matrix;
+
+    auto factor = TSQR(matrix);
+    EXPECT_TRUE(factor.levels.empty());
+    EXPECT_EQ(factor.GetR().Rows(), 0);
+}
+
+TEST(TEST_TSQR, TSQRSingleBlock) {
+    Matrix<> matrix = {{3, 1}, {4, 2}, {0, 5}};
+
+    auto factor = TSQR(matrix);
+    EXPECT_EQ(factor.levels.size(), 1);
+    CheckTSQR(matrix, factor);
+    EXPECT_TRUE(AreEqualFloating(std::abs(factor.GetR()(0, 0)), 5.l));
+}
+
+TEST(TEST_TSQR, TSQRTree) {
+    RandomGenerator<double> gen(2);
+    auto matrix = gen.GetMatrix(230, 6) / 100.;
+
+    // 230 / 16 = 14 leaves, merged by 7, 4, 2 and 1 nodes.
+    auto factor = TSQR(matrix, 16);
+    EXPECT_EQ(factor.levels.size(), 5);
+    EXPECT_EQ(factor.levels.front().nodes.size(), 14);
+    CheckTSQR(matrix, factor);
+
+    // R is unique up to the signs of its rows.
+    auto R = factor.GetR();
+    auto expected = CompactQR(matrix).GetR();
+    for (IndexType i = 0; i < R.Rows(); ++i) {
+        for (IndexType j = i; j < R.Columns(); ++j) {
+            EXPECT_TRUE(AreEqualFloating(std::abs(R(i, j)),
+                                         std::abs(expected(i, j))));
+        }
+    }
+}
+
+TEST(TEST_TSQR, TSQRWide) {
+    Matrix<> matrix = {{1, 2, 3, 4}, {5, 6, 7, 8}};
+
+    CheckTSQR(matrix, TSQR(matrix, 1));
+}
+
+TEST(TEST_TSQR, TSQRComplex) {
+    RandomGenerator<Complex<>> gen(3);
+    auto matrix = gen.GetMatrix(97, 5) / Complex<>{100};
+
+    CheckTSQR(matrix, TSQR(matrix, 10));
+}
+
+TEST(TEST_TSQR, TSQRView) {
+    RandomGenerator<double> gen(4);
+    auto matrix = gen.GetMatrix(80, 10) / 100.;
+    auto view = matrix.GetSubmatrix({5, 75}, {2, 6});
+
+    CheckTSQR(view, TSQR(view, 8));
+}
+
+TEST(TEST_TSQR, TSQRLeastSquares) {
+    RandomGenerator<double> gen(5);
+    auto matrix = gen.GetMatrix(300, 4) / 100.;
+    for (IndexType i = 0; i < 4; ++i) {
+        matrix(i, i) += 3.;
+    }
+    auto rhs = gen.GetMatrix(300, 2) / 100.;
+
+    auto X = LeastSquares(TSQR(matrix, 32), rhs);
+    auto expected = LeastSquares(CompactQR(matrix), rhs);
+    EXPECT_TRUE(AreEqualMatrices(X, expected));
+}
+
+TEST(TEST_TSQR, Stress) {
+    using Type = Complex<double>;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 10; ++seed) {
+        MatrixGenerator gen(seed);
+
+        int32_t rows = gen.GetMatrixSize() * 5;
+        int32_t columns = gen.GetMatrixSize() / 10 + 1;
+        int32_t block = gen.GetMatrixSize() + 1;
+
+        auto matrix = gen.GetMatrix(rows, columns) / Type{100};
+        CheckTSQR(matrix, TSQR(matrix, block));
+    }
+}
+} // namespace
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include "../src/algorithms/jacobi_eigen.h"
+#include "../src/matrix_utils/checks.h"
+#include "helpers.h"
+
+namespace {
+template <typename T = long double>
+using Complex = std::complex<T>;
+
+template <typename T = long double>
+using Matrix = LinearKit::Matrix<T>;
+using IndexType = LinearKit::Details::Types::IndexType;
+
+using namespace LinearKit::Algorithm;
+using namespace LinearKit::Utils;
+using namespace LinearKit::MatrixUtils;
+using LinearKit::Tests::RandomGenerator;
+
+template <MatrixType M, typename P>
+void CheckRefined(const M &matrix, const P &pair) {
+    using T = typename M::ElemType;
+
+    auto eps = 1e-10l;
+
+    EXPECT_TRUE(pair.is_converged);
+    EXPECT_TRUE(IsUnitary(pair.U, eps));
+    EXPECT_TRUE(IsDiagonal(pair.D));
+    EXPECT_TRUE(AreEqualMatrices(
+        matrix, pair.U * pair.D * Matrix<T>::Conjugated(pair.U), eps));
+}
+
+template <typename T>
+Matrix<T> GetHermitian(RandomGenerator<T> &gen, IndexType size) {
+    auto matrix = gen.GetMatrix(size, size) / T{100};
+    for (IndexType i = 0; i < size; ++i) {
+        matrix(i, i) = std::real(matrix(i, i));
+        for (IndexType j = 0; j < i; ++j) {
+            matrix(j, i) = Conj(matrix(i, j));
+        }
+    }
+
+    return matrix;
+}
+
+template <typename T>
+Matrix<T> Perturb(RandomGenerator<T> &gen, const Matrix<T> &matrix,
+                  RealType<T> scale) {
+    auto delta = GetHermitian(gen, matrix.Rows());
+    auto result = matrix;
+    for (IndexType i = 0; i < matrix.Rows(); ++i) {
+        for (IndexType j = 0; j < matrix.Columns(); ++j) {
+            result(i, j) += delta(i, j) * scale;
+        }
+    }
+
+    return result;
+}
+
+TEST(TEST_WARM_EIGEN, WarmClear) {
+    Matrix<> matrix;
+
+    auto pair = RefineSpecDecomposition(matrix, matrix);
+    EXPECT_EQ(pair.D.Rows(), 0);
+    EXPECT_EQ(pair.U.Rows(), 0);
+}
+
+TEST(TEST_WARM_EIGEN, WarmExactBasis) {
+    Matrix<> matrix = {{2, 1, 0}, {1, 2, 0}, {0, 0, 5}};
+    auto root = 1 / std::sqrt(2.l);
+    Matrix<> basis = {{root, root, 0}, {-root, root, 0}, {0, 0, 1}};
+
+    auto pair = RefineSpecDecomposition(matrix, basis);
+    EXPECT_FALSE(pair.is_restarted);
+    EXPECT_LE(pair.sweeps, 1);
+    CheckRefined(matrix, pair);
+
+    // The order of the basis is kept.
+    EXPECT_TRUE(AreEqualFloating(pair.D(0, 0), 1.l));
+    EXPECT_TRUE(AreEqualFloating(pair.D(1, 1), 3.l));
+    EXPECT_TRUE(AreEqualFloating(pair.D(2, 2), 5.l));
+}
+
+TEST(TEST_WARM_EIGEN, WarmIdentityRestart) {
+    Matrix<> matrix = {{1, 2, 3}, {2, 4, 5}, {3, 5, 6}};
+
+    auto pair = RefineSpecDecomposition(matrix, Matrix<>::Identity(3));
+    EXPECT_TRUE(pair.is_restarted);
+    CheckRefined(matrix, pair);
+}
+
+TEST(TEST_WARM_EIGEN, WarmSlowlyVarying) {
+    RandomGenerator<double> gen(2);
+    auto matrix = GetHermitian(gen, 30);
+
+    auto pair = RefineSpecDecomposition(matrix, Matrix<double>::Identity(30));
+    CheckRefined(matrix, pair);
+
+    for (int tick = 0; tick < 10; ++tick) {
+        matrix = Perturb(gen, matrix, 1e-3);
+        pair = RefineSpecDecomposition(matrix, pair.U);
+
+        EXPECT_FALSE(pair.is_restarted);
+        EXPECT_LE(pair.sweeps, 4);
+        CheckRefined(matrix, pair);
+    }
+}
+
+TEST(TEST_WARM_EIGEN, WarmLargeChange) {
+    RandomGenerator<double> gen(3);
+    auto matrix = GetHermitian(gen, 20);
+    auto pair = RefineSpecDecomposition(matrix, Matrix<double>::Identity(20));
+
+    auto other = GetHermitian(gen, 20);
+    auto next = RefineSpecDecomposition(other, pair.U);
+    EXPECT_TRUE(next.is_restarted);
+    CheckRefined(other, next);
+}
+
+TEST(TEST_WARM_EIGEN, WarmComplex) {
+    RandomGenerator<Complex<>> gen(4);
+    auto matrix = GetHermitian(gen, 12);
+
+    auto pair =
+        RefineSpecDecomposition(matrix, Matrix<Complex<>>::Identity(12));
+    CheckRefined(matrix, pair);
+
+    auto next = Perturb(gen, matrix, 1e-4l);
+    auto warm = RefineSpecDecomposition(next, pair.U);
+    EXPECT_FALSE(warm.is_restarted);
+    CheckRefined(next, warm);
+}
+
+TEST(TEST_WARM_EIGEN, WarmView) {
+    Matrix<> matrix = {{0, 0, 0, 0},
+                       {0, 4, 1, 0},
+                       {0, 1, 4, 0},
+                       {0, 0, 0, 0}};
+    auto view = matrix.GetSubmatrix({1, 3}, {1, 3});
+    auto basis = Matrix<>::Identity(2);
+
+    auto pair =
+        RefineSpecDecomposition(view, basis.GetSubmatrix({0, 2}, {0, 2}));
+    CheckRefined(Matrix<>(view), pair);
+}
+
+TEST(TEST_WARM_EIGEN, Stress) {
+    using Type = double;
+    using MatrixGenerator = RandomGenerator<Type>;
+
+    for (int32_t seed = 1; seed < 10; ++seed) {
+        MatrixGenerator gen(seed);
+
+        int32_t size = gen.GetMatrixSize() / 2 + 1;
+        auto matrix = GetHermitian(gen, size);
+        auto pair =
+            RefineSpecDecomposition(matrix, Matrix<Type>::Identity(size));
+        CheckRefined(matrix, pair);
+
+        auto next = Perturb(gen, matrix, 1e-2);
+        auto warm = RefineSpecDecomposition(next, pair.U);
+        CheckRefined(next, warm);
+    }
+}
+} // namespace